@@ -96,6 +96,61 @@ public:
 	}
 };
 
+class RemoteDebugger::AllocationProfiler : public EngineProfiler {
+	static const uint32_t MAX_SITES = 32;
+
+	uint64_t last_send_time = 0;
+	bool was_tracking = false;
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (p_enable) {
+			// Tracking may already be on from the project settings, leave it on when the profiler stops in that case.
+			was_tracking = Memory::is_allocation_tracking_enabled();
+			uint32_t interval = p_opts.size() > 0 ? (uint32_t)int(p_opts[0]) : 1024;
+			Memory::set_allocation_tracking_enabled(true, interval);
+			Memory::reset_allocation_tracking();
+		} else if (!was_tracking) {
+			Memory::set_allocation_tracking_enabled(false);
+		}
+	}
+	void add(const Array &p_data) {}
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		uint64_t pt = OS::get_singleton()->get_ticks_msec();
+		if (pt - last_send_time < 1000) {
+			return;
+		}
+		last_send_time = pt;
+
+		// Layout: tag count, then [name, frame count, frame bytes, total count, total bytes] per tag,
+		// then site count, then [address, tag name, samples, sampled bytes] per site.
+		Array arr;
+		arr.push_back(Memory::ALLOCATION_TAG_MAX);
+		for (int i = 0; i < Memory::ALLOCATION_TAG_MAX; i++) {
+			Memory::AllocationTag tag = Memory::AllocationTag(i);
+			Memory::AllocationStats frame = Memory::get_frame_allocation_stats(tag);
+			Memory::AllocationStats total = Memory::get_total_allocation_stats(tag);
+			arr.push_back(Memory::get_allocation_tag_name(tag));
+			arr.push_back(frame.count);
+			arr.push_back(frame.bytes);
+			arr.push_back(total.count);
+			arr.push_back(total.bytes);
+		}
+
+		Memory::AllocationSite sites[MAX_SITES];
+		uint32_t site_count = Memory::get_allocation_sites(sites, MAX_SITES);
+		arr.push_back(site_count);
+		for (uint32_t i = 0; i < site_count; i++) {
+			arr.push_back("0x" + String::num_uint64((uint64_t)sites[i].address, 16));
+			arr.push_back(Memory::get_allocation_tag_name(sites[i].tag));
+			arr.push_back(sites[i].samples);
+			arr.push_back(sites[i].bytes);
+		}
+
+		EngineDebugger::get_singleton()->send_message("allocations:profile_frame", arr);
+	}
+};
+
 Error RemoteDebugger::_put_msg(const String &p_message, const Array &p_data) {
 	Array msg;
 	msg.push_back(p_message);
@@ -708,6 +763,10 @@ RemoteDebugger::RemoteDebugger(Ref<RemoteDebuggerPeer> p_peer) {
 		profiler_enable("performance", true);
 	}
 
+	// Allocation Profiler
+	allocation_profiler.instantiate();
+	allocation_profiler->bind("allocations");
+
 	// Core and profiler captures.
 	Capture core_cap(this,
 			[](void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured) {
@@ -53,8 +53,10 @@ private:
 	typedef DebuggerMarshalls::OutputError ErrorMessage;
 
 	class PerformanceProfiler;
+	class AllocationProfiler;
 
 	Ref<PerformanceProfiler> performance_profiler;
+	Ref<AllocationProfiler> allocation_profiler;
 
 	Ref<RemoteDebuggerPeer> peer;
 
@@ -181,6 +181,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; } ///< get a pointer to the next p_length bytes and advance past them without copying, or nullptr (reading nothing) if the backend doesn't hold them in memory.
+	virtual const uint8_t *map_read_only() { return nullptr; } ///< map the whole file read-only, the view stays valid until the file is closed. Returns nullptr if the backend can't map files.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
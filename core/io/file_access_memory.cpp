@@ -143,6 +143,17 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessMemory::get_buffer_view(uint64_t p_length) const {
+	// pos isn't clamped by seek(), so check it first or length - pos wraps around.
+	if (!data || pos > length || p_length > length - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *view = &data[pos];
+	pos += p_length;
+	return view;
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
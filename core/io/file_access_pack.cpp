@@ -327,7 +327,36 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	return true;
 }
 
+Ref<FileAccess> PackedSourcePCK::_get_mapped_pack(const String &p_pack, uint64_t &r_length) {
+	MutexLock lock(mapped_packs_mutex);
+
+	HashMap<String, MappedPack>::Iterator E = mapped_packs.find(p_pack);
+	if (E) {
+		r_length = E->value.length;
+		return E->value.file;
+	}
+
+	MappedPack pack;
+	pack.file = FileAccess::open(p_pack, FileAccess::READ);
+	if (pack.file.is_valid() && !pack.file->map_read_only()) {
+		pack.file = Ref<FileAccess>();
+	}
+	if (pack.file.is_valid()) {
+		pack.length = pack.file->get_length();
+	}
+	mapped_packs.insert(p_pack, pack);
+	r_length = pack.length;
+	return pack.file;
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
+	if (!p_file->encrypted) {
+		uint64_t pack_length = 0;
+		Ref<FileAccess> pack = _get_mapped_pack(p_file->pack, pack_length);
+		if (pack.is_valid() && p_file->offset + p_file->size <= pack_length) {
+			return memnew(FileAccessPack(p_path, *p_file, pack));
+		}
+	}
 	return memnew(FileAccessPack(p_path, *p_file));
 }
 
@@ -377,7 +406,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped_data) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -385,7 +416,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -393,7 +424,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -414,7 +447,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped_data, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -432,16 +465,32 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + pos - to_read, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!mapped_data || eof || pos > pf.size || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *view = mapped_data + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -465,6 +514,8 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_pack = Ref<FileAccess>();
+	mapped_data = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
@@ -495,6 +546,15 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 	eof = false;
 }
 
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_pack) :
+		pf(p_file),
+		pos(0),
+		eof(false),
+		off(p_file.offset),
+		mapped_pack(p_mapped_pack) {
+	mapped_data = mapped_pack->map_read_only() + off;
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // DIR ACCESS
 //////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
@@ -144,6 +145,18 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+	// Packs kept open and mapped read-only, shared by every file read from them.
+	// A null entry means the pack can't be mapped and files are read through regular I/O.
+	struct MappedPack {
+		Ref<FileAccess> file;
+		uint64_t length = 0; // Read once, asking the shared file would race on its position.
+	};
+
+	Mutex mapped_packs_mutex;
+	HashMap<String, MappedPack> mapped_packs;
+
+	Ref<FileAccess> _get_mapped_pack(const String &p_pack, uint64_t &r_length);
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
@@ -165,6 +178,10 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Set instead of `f` when the pack is memory mapped; points at the start of this file.
+	Ref<FileAccess> mapped_pack;
+	const uint8_t *mapped_data = nullptr;
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
@@ -186,6 +203,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -200,6 +218,7 @@ public:
 	virtual void close() override;
 
 	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_pack);
 };
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
@@ -1606,6 +1606,522 @@ Variant JSON::_to_native(const Variant &p_json, bool p_allow_objects, int p_dept
 #undef ARGS
 #undef PROPS
 
+void JSONReader::_reset() {
+	file.unref();
+	file_view = false;
+	data.clear();
+	buffer = nullptr;
+	buffer_size = 0;
+	buffer_pos = 0;
+	state = STATE_VALUE;
+	event = EVENT_NONE;
+	stack.clear();
+	line = 0;
+	err = OK;
+	err_str.clear();
+}
+
+Error JSONReader::open_file(const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+
+	_reset();
+	file = p_file;
+
+	// Files already held in memory (such as mapped packs) are read in place.
+	const uint64_t remaining = p_file->get_length() - p_file->get_position();
+	buffer = p_file->get_buffer_view(remaining);
+	if (buffer) {
+		file_view = true;
+		buffer_size = remaining;
+	} else {
+		chunk.resize(CHUNK_SIZE);
+	}
+
+	// Skip the UTF-8 BOM, if any.
+	if (_peek() == 0xEF && buffer_pos + 2 < buffer_size && buffer[buffer_pos + 1] == 0xBB && buffer[buffer_pos + 2] == 0xBF) {
+		buffer_pos += 3;
+	}
+	return OK;
+}
+
+void JSONReader::open_buffer(const Vector<uint8_t> &p_buffer) {
+	_reset();
+	data = p_buffer;
+	buffer = data.ptr();
+	buffer_size = data.size();
+
+	if (buffer_size >= 3 && buffer[0] == 0xEF && buffer[1] == 0xBB && buffer[2] == 0xBF) {
+		buffer_pos = 3;
+	}
+}
+
+bool JSONReader::_fill() {
+	if (file.is_null() || file_view) {
+		return false;
+	}
+	buffer = chunk.ptr();
+	buffer_size = file->get_buffer(chunk.ptr(), CHUNK_SIZE);
+	buffer_pos = 0;
+	return buffer_size > 0;
+}
+
+void JSONReader::_skip_whitespace() {
+	do {
+		while (buffer_pos < buffer_size) {
+			const uint8_t c = buffer[buffer_pos];
+			if (c > 32) {
+				return;
+			}
+			if (c == '\n') {
+				line++;
+			}
+			buffer_pos++;
+		}
+	} while (_fill());
+}
+
+JSONReader::Event JSONReader::_error(const String &p_message, Error p_error) {
+	if (err == OK) {
+		err = p_error;
+		err_str = p_message;
+	}
+	event = EVENT_ERROR;
+	return event;
+}
+
+Error JSONReader::_parse_hex(char32_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < 4; i++) {
+		const int c = _peek();
+		if (c == -1) {
+			_error("Unterminated string");
+			return err;
+		}
+		if (!is_hex_digit(c)) {
+			_error("Malformed hex constant in string");
+			return err;
+		}
+		buffer_pos++;
+		r_value <<= 4;
+		if (is_digit(c)) {
+			r_value |= c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			r_value |= c - 'a' + 10;
+		} else {
+			r_value |= c - 'A' + 10;
+		}
+	}
+	return OK;
+}
+
+JSONReader::Event JSONReader::_parse_string() {
+	// The opening quote was already consumed.
+	scratch.clear();
+	while (true) {
+		if (buffer_pos == buffer_size && !_fill()) {
+			return _error("Unterminated string");
+		}
+
+		// Copy plain runs of bytes in one go, they are decoded from UTF-8 at the end.
+		const uint64_t run_start = buffer_pos;
+		while (buffer_pos < buffer_size) {
+			const uint8_t c = buffer[buffer_pos];
+			if (c == '"' || c == '\\' || c == '\n') {
+				break;
+			}
+			buffer_pos++;
+		}
+		if (buffer_pos > run_start) {
+			const uint32_t size = scratch.size();
+			scratch.resize(size + (buffer_pos - run_start));
+			memcpy(scratch.ptr() + size, buffer + run_start, buffer_pos - run_start);
+		}
+		if (buffer_pos == buffer_size) {
+			continue;
+		}
+
+		const uint8_t c = buffer[buffer_pos++];
+		if (c == '"') {
+			break;
+		} else if (c == '\n') {
+			line++;
+			scratch.push_back('\n');
+			continue;
+		}
+
+		// Escaped characters.
+		const int next = _peek();
+		if (next == -1) {
+			return _error("Unterminated string");
+		}
+		buffer_pos++;
+
+		char32_t res = 0;
+		switch (next) {
+			case 'b':
+				res = 8;
+				break;
+			case 't':
+				res = 9;
+				break;
+			case 'n':
+				res = 10;
+				break;
+			case 'f':
+				res = 12;
+				break;
+			case 'r':
+				res = 13;
+				break;
+			case '"':
+			case '\\':
+			case '/':
+				res = next;
+				break;
+			case 'u': {
+				if (_parse_hex(res) != OK) {
+					return event;
+				}
+				if ((res & 0xfffffc00) == 0xd800) {
+					if (_peek() != '\\') {
+						return _error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+					}
+					buffer_pos++;
+					if (_peek() != 'u') {
+						return _error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+					}
+					buffer_pos++;
+					char32_t trail = 0;
+					if (_parse_hex(trail) != OK) {
+						return event;
+					}
+					if ((trail & 0xfffffc00) != 0xdc00) {
+						return _error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+					}
+					res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+				} else if ((res & 0xfffffc00) == 0xdc00) {
+					return _error("Invalid UTF-16 sequence in string, unpaired trail surrogate");
+				}
+			} break;
+			default: {
+				return _error("Invalid escape sequence");
+			}
+		}
+
+		// Encode back to UTF-8, so the whole string is decoded at once.
+		if (res < 0x80) {
+			scratch.push_back(res);
+		} else if (res < 0x800) {
+			scratch.push_back(0xC0 | (res >> 6));
+			scratch.push_back(0x80 | (res & 0x3F));
+		} else if (res < 0x10000) {
+			scratch.push_back(0xE0 | (res >> 12));
+			scratch.push_back(0x80 | ((res >> 6) & 0x3F));
+			scratch.push_back(0x80 | (res & 0x3F));
+		} else {
+			scratch.push_back(0xF0 | (res >> 18));
+			scratch.push_back(0x80 | ((res >> 12) & 0x3F));
+			scratch.push_back(0x80 | ((res >> 6) & 0x3F));
+			scratch.push_back(0x80 | (res & 0x3F));
+		}
+	}
+
+	string_value.clear();
+	if (!scratch.is_empty()) {
+		string_value.parse_utf8(scratch.ptr(), scratch.size());
+	}
+	return EVENT_STRING;
+}
+
+JSONReader::Event JSONReader::_parse_number() {
+	scratch.clear();
+	int c = _peek();
+	if (c == '-') {
+		scratch.push_back(c);
+		buffer_pos++;
+		c = _peek();
+	}
+	while (is_digit(c)) {
+		scratch.push_back(c);
+		buffer_pos++;
+		c = _peek();
+	}
+	if (c == '.') {
+		scratch.push_back(c);
+		buffer_pos++;
+		c = _peek();
+		while (is_digit(c)) {
+			scratch.push_back(c);
+			buffer_pos++;
+			c = _peek();
+		}
+	}
+	if (c == 'e' || c == 'E') {
+		scratch.push_back(c);
+		buffer_pos++;
+		c = _peek();
+		if (c == '+' || c == '-') {
+			scratch.push_back(c);
+			buffer_pos++;
+			c = _peek();
+		}
+		while (is_digit(c)) {
+			scratch.push_back(c);
+			buffer_pos++;
+			c = _peek();
+		}
+	}
+	scratch.push_back(0);
+
+	number_value = String::to_float(scratch.ptr());
+	event = EVENT_NUMBER;
+	return event;
+}
+
+JSONReader::Event JSONReader::_parse_identifier() {
+	scratch.clear();
+	int c = _peek();
+	while (is_ascii_alphabet_char(c)) {
+		scratch.push_back(c);
+		buffer_pos++;
+		c = _peek();
+	}
+	scratch.push_back(0);
+
+	const char *id = scratch.ptr();
+	if (strcmp(id, "true") == 0) {
+		bool_value = true;
+		event = EVENT_BOOL;
+	} else if (strcmp(id, "false") == 0) {
+		bool_value = false;
+		event = EVENT_BOOL;
+	} else if (strcmp(id, "null") == 0) {
+		event = EVENT_NULL;
+	} else {
+		return _error(vformat("Expected 'true', 'false', or 'null', got '%s'", String::utf8(id)));
+	}
+	return event;
+}
+
+JSONReader::Event JSONReader::next() {
+	if (event == EVENT_ERROR || event == EVENT_EOF) {
+		return event;
+	}
+
+	_skip_whitespace();
+	int c = _peek();
+	if (c == -1 && !stack.is_empty()) {
+		return _error(stack[stack.size() - 1] == EVENT_OBJECT_BEGIN ? "Expected '}'" : "Expected ']'");
+	}
+
+	if (state == STATE_NEXT) {
+		if (stack.is_empty()) {
+			if (c != -1) {
+				return _error("Expected 'EOF'");
+			}
+			event = EVENT_EOF;
+			return event;
+		}
+
+		const bool in_object = stack[stack.size() - 1] == EVENT_OBJECT_BEGIN;
+		if (c == ',') {
+			buffer_pos++;
+			state = in_object ? STATE_OBJECT_KEY : STATE_ARRAY_VALUE;
+			_skip_whitespace();
+			c = _peek();
+			if (c == -1) {
+				return _error(in_object ? "Expected '}'" : "Expected ']'");
+			}
+		} else if (c == (in_object ? '}' : ']')) {
+			buffer_pos++;
+			stack.resize(stack.size() - 1);
+			event = in_object ? EVENT_OBJECT_END : EVENT_ARRAY_END;
+			return event;
+		} else {
+			return _error(in_object ? "Expected '}' or ','" : "Expected ','");
+		}
+	}
+
+	if (state == STATE_OBJECT_KEY) {
+		if (c == '}') {
+			buffer_pos++;
+			stack.resize(stack.size() - 1);
+			state = STATE_NEXT;
+			event = EVENT_OBJECT_END;
+			return event;
+		}
+		if (c != '"') {
+			return _error("Expected key");
+		}
+		buffer_pos++;
+		if (_parse_string() == EVENT_ERROR) {
+			return event;
+		}
+		_skip_whitespace();
+		if (_peek() != ':') {
+			return _error("Expected ':'");
+		}
+		buffer_pos++;
+		state = STATE_VALUE;
+		event = EVENT_KEY;
+		return event;
+	}
+
+	if (state == STATE_ARRAY_VALUE && c == ']') {
+		buffer_pos++;
+		stack.resize(stack.size() - 1);
+		state = STATE_NEXT;
+		event = EVENT_ARRAY_END;
+		return event;
+	}
+
+	state = STATE_NEXT;
+	switch (c) {
+		case '{':
+		case '[': {
+			if (stack.size() > Variant::MAX_RECURSION_DEPTH) {
+				return _error("JSON structure is too deep", ERR_OUT_OF_MEMORY);
+			}
+			buffer_pos++;
+			event = c == '{' ? EVENT_OBJECT_BEGIN : EVENT_ARRAY_BEGIN;
+			state = c == '{' ? STATE_OBJECT_KEY : STATE_ARRAY_VALUE;
+			stack.push_back(event);
+			return event;
+		}
+		case '"': {
+			buffer_pos++;
+			event = _parse_string();
+			return event;
+		}
+		case -1: {
+			return _error("Expected value, got 'EOF'");
+		}
+		default: {
+			if (c == '-' || is_digit(c)) {
+				return _parse_number();
+			} else if (is_ascii_alphabet_char(c)) {
+				return _parse_identifier();
+			}
+			return _error("Unexpected character");
+		}
+	}
+}
+
+Error JSONReader::read_value(Variant &r_value) {
+	switch (event) {
+		case EVENT_STRING: {
+			r_value = string_value;
+		} break;
+		case EVENT_NUMBER: {
+			r_value = number_value;
+		} break;
+		case EVENT_BOOL: {
+			r_value = bool_value;
+		} break;
+		case EVENT_NULL: {
+			r_value = Variant();
+		} break;
+		case EVENT_ARRAY_BEGIN: {
+			Array array;
+			while (next() != EVENT_ARRAY_END) {
+				if (event == EVENT_ERROR) {
+					return err;
+				}
+				Variant value;
+				if (read_value(value) != OK) {
+					return err;
+				}
+				array.push_back(value);
+			}
+			r_value = array;
+		} break;
+		case EVENT_OBJECT_BEGIN: {
+			Dictionary object;
+			while (next() != EVENT_OBJECT_END) {
+				if (event == EVENT_ERROR) {
+					return err;
+				}
+				const String key = string_value;
+				if (next() == EVENT_ERROR) {
+					return err;
+				}
+				Variant value;
+				if (read_value(value) != OK) {
+					return err;
+				}
+				object[key] = value;
+			}
+			r_value = object;
+		} break;
+		case EVENT_ERROR: {
+			return err;
+		}
+		default: {
+			ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "The last event read doesn't start a value.");
+		}
+	}
+	return OK;
+}
+
+Error JSONReader::skip_value() {
+	if (event == EVENT_ERROR) {
+		return err;
+	}
+	if (event == EVENT_ARRAY_BEGIN || event == EVENT_OBJECT_BEGIN) {
+		const uint32_t depth = stack.size();
+		while (stack.size() >= depth) {
+			if (next() == EVENT_ERROR) {
+				return err;
+			}
+		}
+	}
+	return OK;
+}
+
+template <typename T>
+Error JSONReader::_read_number_array(Vector<T> &r_array) {
+	if (event == EVENT_ERROR) {
+		return err;
+	}
+	ERR_FAIL_COND_V_MSG(event != EVENT_ARRAY_BEGIN, ERR_INVALID_PARAMETER, "The last event read doesn't start an array.");
+
+	r_array.clear();
+	while (next() != EVENT_ARRAY_END) {
+		if (event != EVENT_NUMBER) {
+			if (event != EVENT_ERROR) {
+				_error("Expected number");
+			}
+			return err;
+		}
+		r_array.push_back(T(number_value));
+	}
+	return OK;
+}
+
+Error JSONReader::read_number_array(Vector<int32_t> &r_array) {
+	return _read_number_array(r_array);
+}
+
+Error JSONReader::read_number_array(Vector<int64_t> &r_array) {
+	return _read_number_array(r_array);
+}
+
+Error JSONReader::read_number_array(Vector<float> &r_array) {
+	return _read_number_array(r_array);
+}
+
+Error JSONReader::read_number_array(Vector<double> &r_array) {
+	return _read_number_array(r_array);
+}
+
+Error JSONReader::parse(Variant &r_value) {
+	if (next() == EVENT_ERROR || read_value(r_value) != OK || next() != EVENT_EOF) {
+		r_value = Variant();
+		return err != OK ? err : ERR_PARSE_ERROR;
+	}
+	return OK;
+}
+
 ////////////
 
 Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
@@ -1621,9 +2137,32 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err;
+	int err_line = 0;
+	String err_message;
+	if (Engine::get_singleton()->is_editor_hint()) {
+		// The editor keeps the text around, for the script editor.
+		err = json->parse(FileAccess::get_file_as_string(p_path), true);
+		err_line = json->get_error_line();
+		err_message = json->get_error_message();
+	} else {
+		// Stream it, so the UTF-8 text is never converted as a whole.
+		Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+		ERR_FAIL_COND_V_MSG(f.is_null(), Ref<Resource>(), vformat("Cannot open file '%s'.", p_path));
+
+		JSONReader reader;
+		reader.open_file(f);
+		Variant data;
+		err = reader.parse(data);
+		if (err == OK) {
+			json->set_data(data);
+		} else {
+			err_line = reader.get_error_line();
+			err_message = reader.get_error_message();
+		}
+	}
 	if (err != OK) {
-		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
+		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(err_line) + ": " + err_message;
 
 		if (Engine::get_singleton()->is_editor_hint()) {
 			// If running on editor, still allow opening the JSON so the code editor can edit it.
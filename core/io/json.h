@@ -33,6 +33,7 @@
 #ifndef JSON_H
 #define JSON_H
 
+#include "core/io/file_access.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
@@ -109,6 +110,104 @@ public:
 	_FORCE_INLINE_ String get_error_message() const { return err_str; }
 };
 
+// Pull parser reading UTF-8 JSON straight from a file or a byte buffer, a chunk at a time,
+// instead of converting the whole text to a String and building the whole Variant tree.
+// Call next() to advance one event at a time, and read_value() or read_number_array()
+// to materialize only the values that are actually needed.
+class JSONReader {
+public:
+	enum Event {
+		EVENT_NONE,
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_KEY,
+		EVENT_STRING,
+		EVENT_NUMBER,
+		EVENT_BOOL,
+		EVENT_NULL,
+		EVENT_EOF,
+		EVENT_ERROR,
+	};
+
+private:
+	enum State {
+		STATE_VALUE,
+		STATE_ARRAY_VALUE, // A value, or the end of the array.
+		STATE_OBJECT_KEY, // A key, or the end of the object.
+		STATE_NEXT, // A comma, or the end of the container.
+	};
+
+	static const uint64_t CHUNK_SIZE = 65536;
+
+	Ref<FileAccess> file;
+	bool file_view = false;
+	Vector<uint8_t> data;
+	LocalVector<uint8_t> chunk;
+	const uint8_t *buffer = nullptr;
+	uint64_t buffer_size = 0;
+	uint64_t buffer_pos = 0;
+
+	State state = STATE_VALUE;
+	Event event = EVENT_NONE;
+	LocalVector<Event> stack; // Open containers.
+	LocalVector<char> scratch;
+
+	String string_value;
+	double number_value = 0.0;
+	bool bool_value = false;
+
+	int line = 0;
+	Error err = OK;
+	String err_str;
+
+	void _reset();
+	bool _fill();
+	_FORCE_INLINE_ int _peek() {
+		if (buffer_pos == buffer_size && !_fill()) {
+			return -1;
+		}
+		return buffer[buffer_pos];
+	}
+	void _skip_whitespace();
+	Event _error(const String &p_message, Error p_error = ERR_PARSE_ERROR);
+	Event _parse_string();
+	Error _parse_hex(char32_t &r_value);
+	Event _parse_number();
+	Event _parse_identifier();
+
+	template <typename T>
+	Error _read_number_array(Vector<T> &r_array);
+
+public:
+	Error open_file(const Ref<FileAccess> &p_file);
+	void open_buffer(const Vector<uint8_t> &p_buffer);
+
+	Event next();
+	_FORCE_INLINE_ Event get_event() const { return event; }
+	_FORCE_INLINE_ int get_depth() const { return stack.size(); }
+
+	// Value of the last EVENT_KEY or EVENT_STRING.
+	_FORCE_INLINE_ const String &get_string() const { return string_value; }
+	_FORCE_INLINE_ double get_number() const { return number_value; }
+	_FORCE_INLINE_ bool get_bool() const { return bool_value; }
+
+	// These act on the value the last event started, and leave the reader after it.
+	Error read_value(Variant &r_value);
+	Error skip_value();
+	Error read_number_array(Vector<int32_t> &r_array);
+	Error read_number_array(Vector<int64_t> &r_array);
+	Error read_number_array(Vector<float> &r_array);
+	Error read_number_array(Vector<double> &r_array);
+
+	// Reads the whole document, like JSON::parse().
+	Error parse(Variant &r_value);
+
+	_FORCE_INLINE_ int get_error_line() const { return err != OK ? line : 0; }
+	_FORCE_INLINE_ String get_error_message() const { return err_str; }
+};
+
 class ResourceFormatLoaderJSON : public ResourceFormatLoader {
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
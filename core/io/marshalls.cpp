@@ -58,6 +58,12 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define ERR_FAIL_ADD_OF(a, b, err) ERR_FAIL_COND_V(((int32_t)(b)) < 0 || ((int32_t)(a)) < 0 || ((int32_t)(a)) > INT_MAX - ((int32_t)(b)), err)
 #define ERR_FAIL_MUL_OF(a, b, err) ERR_FAIL_COND_V(((int32_t)(a)) < 0 || ((int32_t)(b)) <= 0 || ((int32_t)(a)) > INT_MAX / ((int32_t)(b)), err)
 
+// Packed vector and color arrays are encoded and decoded in bulk as arrays of their components.
+static_assert(sizeof(Vector2) == sizeof(real_t) * 2);
+static_assert(sizeof(Vector3) == sizeof(real_t) * 3);
+static_assert(sizeof(Vector4) == sizeof(real_t) * 4);
+static_assert(sizeof(Color) == sizeof(float) * 4);
+
 // Byte 0: `Variant::Type`, byte 1: unused, bytes 2 and 3: additional data.
 #define HEADER_TYPE_MASK 0xFF
 
@@ -957,12 +963,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int32_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
+				decode_uint32_array(buf, count, reinterpret_cast<uint32_t *>(data.ptrw()));
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -981,12 +983,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int64_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
+				decode_uint64_array(buf, count, reinterpret_cast<uint64_t *>(data.ptrw()));
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -1005,12 +1003,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<float> data;
 
 			if (count) {
-				//const float *rbuf = (const float *)buf;
 				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
+				decode_float_array(buf, count, data.ptrw());
 			}
 			r_variant = data;
 
@@ -1031,10 +1025,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
+				decode_double_array(buf, count, data.ptrw());
 			}
 			r_variant = data;
 
@@ -1088,10 +1079,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					// Same precision as real_t, so the components can be copied in bulk.
+					decode_real_array(buf, count * 2, reinterpret_cast<real_t *>(w));
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 2 + sizeof(double) * 1);
 					}
+#endif
 
 					int adv = sizeof(double) * 2 * count;
 
@@ -1113,10 +1109,15 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector2 *w = varray.ptrw();
 
+#ifndef REAL_T_IS_DOUBLE
+					// Same precision as real_t, so the components can be copied in bulk.
+					decode_real_array(buf, count * 2, reinterpret_cast<real_t *>(w));
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 2 + sizeof(float) * 1);
 					}
+#endif
 
 					int adv = sizeof(float) * 2 * count;
 
@@ -1148,11 +1149,16 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					// Same precision as real_t, so the components can be copied in bulk.
+					decode_real_array(buf, count * 3, reinterpret_cast<real_t *>(w));
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 3 + sizeof(double) * 2);
 					}
+#endif
 
 					int adv = sizeof(double) * 3 * count;
 
@@ -1174,11 +1180,16 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector3 *w = varray.ptrw();
 
+#ifndef REAL_T_IS_DOUBLE
+					// Same precision as real_t, so the components can be copied in bulk.
+					decode_real_array(buf, count * 3, reinterpret_cast<real_t *>(w));
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 3 + sizeof(float) * 2);
 					}
+#endif
 
 					int adv = sizeof(float) * 3 * count;
 
@@ -1209,15 +1220,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				carray.resize(count);
-				Color *w = carray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					// Colors should always be in single-precision.
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
-				}
+				// Colors should always be in single-precision.
+				decode_float_array(buf, count * 4, reinterpret_cast<float *>(carray.ptrw()));
 
 				int adv = 4 * 4 * count;
 
@@ -1250,12 +1254,17 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
+#ifdef REAL_T_IS_DOUBLE
+					// Same precision as real_t, so the components can be copied in bulk.
+					decode_real_array(buf, count * 4, reinterpret_cast<real_t *>(w));
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 0);
 						w[i].y = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 1);
 						w[i].z = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 2);
 						w[i].w = decode_double(buf + i * sizeof(double) * 4 + sizeof(double) * 3);
 					}
+#endif
 
 					int adv = sizeof(double) * 4 * count;
 
@@ -1277,12 +1286,17 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					varray.resize(count);
 					Vector4 *w = varray.ptrw();
 
+#ifndef REAL_T_IS_DOUBLE
+					// Same precision as real_t, so the components can be copied in bulk.
+					decode_real_array(buf, count * 4, reinterpret_cast<real_t *>(w));
+#else
 					for (int32_t i = 0; i < count; i++) {
 						w[i].x = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 0);
 						w[i].y = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 1);
 						w[i].z = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 2);
 						w[i].w = decode_float(buf + i * sizeof(float) * 4 + sizeof(float) * 3);
 					}
+#endif
 
 					int adv = sizeof(float) * 4 * count;
 
@@ -1937,10 +1951,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int32_t *r = data.ptr();
-				for (int32_t i = 0; i < datalen; i++) {
-					encode_uint32(r[i], &buf[i * datasize]);
-				}
+				encode_uint32_array(reinterpret_cast<const uint32_t *>(data.ptr()), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1954,10 +1965,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int64_t *r = data.ptr();
-				for (int64_t i = 0; i < datalen; i++) {
-					encode_uint64(r[i], &buf[i * datasize]);
-				}
+				encode_uint64_array(reinterpret_cast<const uint64_t *>(data.ptr()), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1971,10 +1979,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const float *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_float(r[i], &buf[i * datasize]);
-				}
+				encode_float_array(data.ptr(), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1988,10 +1993,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const double *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_double(r[i], &buf[i * datasize]);
-				}
+				encode_double_array(data.ptr(), datalen, buf);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -2040,13 +2042,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector2 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					buf += sizeof(real_t) * 2;
-				}
+				encode_real_array(reinterpret_cast<const real_t *>(data.ptr()), len * 2, buf);
+				buf += sizeof(real_t) * 2 * len;
 			}
 
 			r_len += sizeof(real_t) * 2 * len;
@@ -2064,14 +2061,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector3 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					encode_real(v.z, &buf[sizeof(real_t) * 2]);
-					buf += sizeof(real_t) * 3;
-				}
+				encode_real_array(reinterpret_cast<const real_t *>(data.ptr()), len * 3, buf);
+				buf += sizeof(real_t) * 3 * len;
 			}
 
 			r_len += sizeof(real_t) * 3 * len;
@@ -2089,15 +2080,9 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Color c = data.get(i);
-
-					encode_float(c.r, &buf[0]);
-					encode_float(c.g, &buf[4]);
-					encode_float(c.b, &buf[8]);
-					encode_float(c.a, &buf[12]);
-					buf += 4 * 4; // Colors should always be in single-precision.
-				}
+				// Colors should always be in single-precision.
+				encode_float_array(reinterpret_cast<const float *>(data.ptr()), len * 4, buf);
+				buf += 4 * 4 * len;
 			}
 
 			r_len += 4 * 4 * len;
@@ -2115,15 +2100,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Vector4 v = data.get(i);
-
-					encode_real(v.x, &buf[0]);
-					encode_real(v.y, &buf[sizeof(real_t)]);
-					encode_real(v.z, &buf[sizeof(real_t) * 2]);
-					encode_real(v.w, &buf[sizeof(real_t) * 3]);
-					buf += sizeof(real_t) * 4;
-				}
+				encode_real_array(reinterpret_cast<const real_t *>(data.ptr()), len * 4, buf);
+				buf += sizeof(real_t) * 4 * len;
 			}
 
 			r_len += sizeof(real_t) * 4 * len;
@@ -209,6 +209,108 @@ static inline double decode_double(const uint8_t *p_arr) {
 	return md.d;
 }
 
+/**
+ * Bulk versions of the above, for packed arrays. The encoded layout is
+ * little endian, so on little endian hosts they are a plain memcpy, and
+ * only big endian hosts go through the per-element byte shifts.
+ */
+
+static inline void encode_uint32_array(const uint32_t *p_src, size_t p_count, uint8_t *p_arr) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		encode_uint32(p_src[i], p_arr + i * sizeof(uint32_t));
+	}
+#else
+	memcpy(p_arr, p_src, p_count * sizeof(uint32_t));
+#endif
+}
+
+static inline void encode_uint64_array(const uint64_t *p_src, size_t p_count, uint8_t *p_arr) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		encode_uint64(p_src[i], p_arr + i * sizeof(uint64_t));
+	}
+#else
+	memcpy(p_arr, p_src, p_count * sizeof(uint64_t));
+#endif
+}
+
+static inline void encode_float_array(const float *p_src, size_t p_count, uint8_t *p_arr) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		encode_float(p_src[i], p_arr + i * sizeof(float));
+	}
+#else
+	memcpy(p_arr, p_src, p_count * sizeof(float));
+#endif
+}
+
+static inline void encode_double_array(const double *p_src, size_t p_count, uint8_t *p_arr) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		encode_double(p_src[i], p_arr + i * sizeof(double));
+	}
+#else
+	memcpy(p_arr, p_src, p_count * sizeof(double));
+#endif
+}
+
+static inline void encode_real_array(const real_t *p_src, size_t p_count, uint8_t *p_arr) {
+#ifdef REAL_T_IS_DOUBLE
+	encode_double_array(p_src, p_count, p_arr);
+#else
+	encode_float_array(p_src, p_count, p_arr);
+#endif
+}
+
+static inline void decode_uint32_array(const uint8_t *p_arr, size_t p_count, uint32_t *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		p_dst[i] = decode_uint32(p_arr + i * sizeof(uint32_t));
+	}
+#else
+	memcpy(p_dst, p_arr, p_count * sizeof(uint32_t));
+#endif
+}
+
+static inline void decode_uint64_array(const uint8_t *p_arr, size_t p_count, uint64_t *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		p_dst[i] = decode_uint64(p_arr + i * sizeof(uint64_t));
+	}
+#else
+	memcpy(p_dst, p_arr, p_count * sizeof(uint64_t));
+#endif
+}
+
+static inline void decode_float_array(const uint8_t *p_arr, size_t p_count, float *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		p_dst[i] = decode_float(p_arr + i * sizeof(float));
+	}
+#else
+	memcpy(p_dst, p_arr, p_count * sizeof(float));
+#endif
+}
+
+static inline void decode_double_array(const uint8_t *p_arr, size_t p_count, double *p_dst) {
+#ifdef BIG_ENDIAN_ENABLED
+	for (size_t i = 0; i < p_count; i++) {
+		p_dst[i] = decode_double(p_arr + i * sizeof(double));
+	}
+#else
+	memcpy(p_dst, p_arr, p_count * sizeof(double));
+#endif
+}
+
+static inline void decode_real_array(const uint8_t *p_arr, size_t p_count, real_t *p_dst) {
+#ifdef REAL_T_IS_DOUBLE
+	decode_double_array(p_arr, p_count, p_dst);
+#else
+	decode_float_array(p_arr, p_count, p_dst);
+#endif
+}
+
 class EncodedObjectAsID : public RefCounted {
 	GDCLASS(EncodedObjectAsID, RefCounted);
 
@@ -157,16 +157,10 @@ StringName ResourceLoaderBinary::_get_string() {
 	uint32_t id = f->get_32();
 	if (id & 0x80000000) {
 		uint32_t len = id & 0x7FFFFFFF;
-		if ((int)len > str_buf.size()) {
-			str_buf.resize(len);
-		}
 		if (len == 0) {
 			return StringName();
 		}
-		f->get_buffer((uint8_t *)&str_buf[0], len);
-		String s;
-		s.parse_utf8(&str_buf[0], len);
-		return s;
+		return _read_utf8(len);
 	}
 
 	return string_map[id];
@@ -409,6 +403,16 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						path += res_path + "::" + itos(index);
 					}
 
+					if (load_on_demand && using_named_scene_ids && !internal_index_cache.has(path)) {
+						const uint64_t return_pos = f->get_position();
+						Ref<Resource> res;
+						Error err = _load_internal_resource(index, res);
+						if (err != OK) {
+							return err;
+						}
+						f->seek(return_pos);
+					}
+
 					//always use internal cache for loading internal resources
 					if (!internal_index_cache.has(path)) {
 						WARN_PRINT(vformat("Couldn't load resource (no cache): %s.", path));
@@ -448,6 +452,12 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
 					} else {
+						if (!external_resources[erindex].load_requested) {
+							Error err = _request_external_resource(erindex);
+							if (err != OK) {
+								return err;
+							}
+						}
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
@@ -680,220 +690,272 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
+Error ResourceLoaderBinary::_request_external_resource(int p_index) {
+	String path = external_resources[p_index].path;
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	if (remaps.has(path)) {
+		path = remaps[path];
+	}
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (!path.contains("://") && path.is_relative_path()) {
+		// path is relative to file being loaded, so convert to a resource path
+		path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[p_index].path));
+	}
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+	external_resources.write[p_index].load_requested = true;
+	external_resources.write[p_index].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+	external_resources.write[p_index].load_token = ResourceLoader::_load_start(path, external_resources[p_index].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+	if (external_resources[p_index].load_token.is_null()) {
+		if (!ResourceLoader::get_abort_on_missing_resources()) {
+			ResourceLoader::notify_dependency_error(local_path, path, external_resources[p_index].type);
+		} else {
+			error = ERR_FILE_MISSING_DEPENDENCIES;
+			ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
 		}
+	}
+	return OK;
+}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+// Loads the internal resource at p_index, with any internal resource it refers to already
+// being in internal_index_cache (or loaded on demand, if doing so).
+Error ResourceLoaderBinary::_load_internal_resource(int p_index, Ref<Resource> &r_res) {
+	bool main = p_index == (internal_resources.size() - 1);
+
+	//maybe it is loaded already
+	String path;
+	const String id = internal_resources[p_index].id;
+
+	if (!main) {
+		path = internal_resources[p_index].path;
+
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				r_res = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	f->seek(offset);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	String t = get_unicode_string();
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-				internal_resources.write[i].path = path; // Update path.
+	MissingResource *missing_resource = nullptr;
+
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource;
+				} else {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
 			}
+
+			res = Ref<Resource>(r);
 		}
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+			}
+		}
+		r->set_scene_unique_id(id);
+	}
 
-		f->seek(offset);
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		String t = get_unicode_string();
+	int pc = f->get_32();
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	//set properties
+
+	Dictionary missing_resource_properties;
 
-		MissingResource *missing_resource = nullptr;
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
-			}
 
-			if (res.is_null()) {
-				//did not replace
-
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+		Variant value;
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
 
-				res = Ref<Resource>(r);
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+				}
+			}
 		}
 
-		int pc = f->get_32();
-
-		//set properties
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
 
-		Dictionary missing_resource_properties;
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
 
-			Variant value;
+	resource_cache.push_back(res);
+	r_res = res;
+	return OK;
+}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+	if (load_on_demand && !using_named_scene_ids) {
+		// Older files refer to sub-resources by their index in the file, and those
+		// references can't be followed without loading everything before them.
+		error = ERR_UNAVAILABLE;
+		ERR_FAIL_V_MSG(error, vformat("'%s': Sub-resource '%s' can't be loaded on its own, because the file uses an old format without sub-resource IDs. Load the whole file instead, or save it again to update it.", local_path, sub_resource_id));
+	}
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
+	if (!load_on_demand) {
+		for (int i = 0; i < external_resources.size(); i++) {
+			error = _request_external_resource(i);
+			if (error != OK) {
+				return error;
 			}
+		}
+	}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
+	for (int i = 0; i < internal_resources.size() - 1; i++) {
+		const String &path = internal_resources[i].path;
+		if (path.begins_with("local://")) {
+			IntResource &ir = internal_resources.write[i];
+			ir.id = path.replace_first("local://", "");
+			ir.path = res_path + "::" + ir.id; // Update path.
+		}
+	}
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
+	if (load_on_demand) {
+		// Only the requested resource is loaded. Whatever it refers to is loaded when
+		// parsed, through the offset table, so the rest of the file is never touched.
+		for (int i = 0; i < internal_resources.size() - 1; i++) {
+			if (internal_resources[i].id != sub_resource_id) {
+				continue;
 			}
-
-			if (set_valid) {
-				res->set(name, value);
+			Ref<Resource> res;
+			error = _load_internal_resource(i, res);
+			if (error != OK) {
+				return error;
 			}
+			f.unref();
+			resource = res;
+			return OK;
 		}
+		error = ERR_DOES_NOT_EXIST;
+		ERR_FAIL_V_MSG(error, vformat("'%s': No sub-resource with ID '%s'.", local_path, sub_resource_id));
+	}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
-		}
-
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	for (int i = 0; i < internal_resources.size(); i++) {
+		Ref<Resource> res;
+		error = _load_internal_resource(i, res);
+		if (error != OK) {
+			return error;
 		}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
-
 		if (progress) {
 			*progress = (i + 1) / float(internal_resources.size());
 		}
 
-		resource_cache.push_back(res);
-
-		if (main) {
+		if (i == internal_resources.size() - 1) {
 			f.unref();
 			resource = res;
 			resource->set_as_translation_remapped(translation_remapped);
@@ -925,18 +987,27 @@ static String get_ustring(Ref<FileAccess> f) {
 	return s;
 }
 
+String ResourceLoaderBinary::_read_utf8(uint32_t p_len) {
+	// Parse straight from the file contents when they are in memory (e.g. a mapped pack).
+	const char *utf8 = (const char *)f->get_buffer_view(p_len);
+	if (!utf8) {
+		if ((int)p_len > str_buf.size()) {
+			str_buf.resize(p_len);
+		}
+		f->get_buffer((uint8_t *)&str_buf[0], p_len);
+		utf8 = &str_buf[0];
+	}
+	String s;
+	s.parse_utf8(utf8, p_len);
+	return s;
+}
+
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
-	if (len == 0) {
+	if (len <= 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
-	String s;
-	s.parse_utf8(&str_buf[0], len);
-	return s;
+	return _read_utf8(len);
 }
 
 void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes) {
@@ -1217,6 +1288,15 @@ String ResourceLoaderBinary::recognize_script_class(Ref<FileAccess> p_f) {
 }
 
 Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
+	// "path::id" loads a single sub-resource, without the rest of the file.
+	int sub_resource_pos = p_path.find("::");
+	if (sub_resource_pos != -1) {
+		return _load(p_path.left(sub_resource_pos), p_original_path.get_slice("::", 0), p_path.substr(sub_resource_pos + 2), r_error, false, r_progress, p_cache_mode);
+	}
+	return _load(p_path, p_original_path, String(), r_error, p_use_sub_threads, r_progress, p_cache_mode);
+}
+
+Ref<Resource> ResourceFormatLoaderBinary::_load(const String &p_path, const String &p_original_path, const String &p_sub_resource_id, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) {
 	if (r_error) {
 		*r_error = ERR_FILE_CANT_OPEN;
 	}
@@ -1245,6 +1325,8 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	}
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
+	loader.load_on_demand = !p_sub_resource_id.is_empty();
+	loader.sub_resource_id = p_sub_resource_id;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
@@ -1262,6 +1344,15 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	return loader.resource;
 }
 
+bool ResourceFormatLoaderBinary::recognize_path(const String &p_path, const String &p_for_type) const {
+	int sub_resource_pos = p_path.find("::");
+	if (sub_resource_pos == -1) {
+		return ResourceFormatLoader::recognize_path(p_path, p_for_type);
+	}
+	// The type hint is the sub-resource's, not the file's.
+	return ResourceFormatLoader::recognize_path(p_path.left(sub_resource_pos));
+}
+
 void ResourceFormatLoaderBinary::get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const {
 	if (p_type.is_empty()) {
 		get_recognized_extensions(p_extensions);
@@ -57,12 +57,14 @@ class ResourceLoaderBinary {
 	Vector<StringName> string_map;
 
 	StringName _get_string();
+	String _read_utf8(uint32_t p_len);
 
 	struct ExtResource {
 		String path;
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		bool load_requested = false;
 	};
 
 	bool using_named_scene_ids = false;
@@ -74,6 +76,7 @@ class ResourceLoaderBinary {
 
 	struct IntResource {
 		String path;
+		String id;
 		uint64_t offset;
 	};
 
@@ -91,7 +94,13 @@ class ResourceLoaderBinary {
 
 	friend class ResourceFormatLoaderBinary;
 
+	// Loading a single sub-resource materializes only what it refers to.
+	bool load_on_demand = false;
+	String sub_resource_id;
+
 	Error parse_variant(Variant &r_v);
+	Error _request_external_resource(int p_index);
+	Error _load_internal_resource(int p_index, Ref<Resource> &r_res);
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
@@ -111,8 +120,11 @@ public:
 };
 
 class ResourceFormatLoaderBinary : public ResourceFormatLoader {
+	Ref<Resource> _load(const String &p_path, const String &p_original_path, const String &p_sub_resource_id, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode);
+
 public:
 	virtual Ref<Resource> load(const String &p_path, const String &p_original_path = "", Error *r_error = nullptr, bool p_use_sub_threads = false, float *r_progress = nullptr, CacheMode p_cache_mode = CACHE_MODE_REUSE) override;
+	virtual bool recognize_path(const String &p_path, const String &p_for_type = String()) const override;
 	virtual void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions) const override;
 	virtual void get_recognized_extensions(List<String> *p_extensions) const override;
 	virtual bool handles_type(const String &p_type) const override;
@@ -290,6 +290,8 @@ ResourceLoader::LoadToken::~LoadToken() {
 }
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_RESOURCE);
+
 	const String &original_path = p_original_path.is_empty() ? p_path : p_original_path;
 	load_nesting++;
 	if (load_paths_stack.size()) {
@@ -541,6 +543,167 @@ void ResourceLoader::_load_threaded_request_setup_user_token(LoadToken *p_token,
 	print_lt("REQUEST: user load tokens: " + itos(user_load_tokens.size()));
 }
 
+Error ResourceLoader::load_threaded_prefetch(const Vector<String> &p_paths, bool p_high_priority) {
+	ERR_FAIL_COND_V(p_paths.is_empty(), ERR_INVALID_PARAMETER);
+
+	// Every path behaves like a threaded request with sub-threads, so results
+	// are collected with load_threaded_get() as usual.
+	PrefetchRequest *request = memnew(PrefetchRequest);
+	request->high_priority = p_high_priority;
+	Error err = OK;
+	for (const String &path : p_paths) {
+		Ref<LoadToken> token = _load_start(path, "", LOAD_THREAD_DISTRIBUTE, ResourceFormatLoader::CACHE_MODE_REUSE, true, p_high_priority);
+		if (token.is_valid()) {
+			request->tokens.push_back(token);
+		} else {
+			err = FAILED;
+		}
+	}
+
+	if (request->tokens.is_empty()) {
+		memdelete(request);
+		return err;
+	}
+
+	// Dependencies are discovered off the caller thread, since that involves
+	// reading the header of every file in the graph.
+	WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_prefetch_request, request, p_high_priority, "ResourceLoader prefetch");
+	return err;
+}
+
+String ResourceLoader::_get_dependency_path(const String &p_dependency) {
+	// Dependencies come as "path", or "uid::type::fallback_path" from loaders that track UIDs.
+	const String path = p_dependency.get_slice("::", 0);
+	if (path.begins_with("uid://")) {
+		const ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(path);
+		if (uid != ResourceUID::INVALID_ID && ResourceUID::get_singleton()->has_id(uid)) {
+			return ResourceUID::get_singleton()->get_id_path(uid);
+		}
+		return p_dependency.get_slice("::", 2);
+	}
+	return path;
+}
+
+void ResourceLoader::_run_prefetch_request(void *p_userdata) {
+	PrefetchRequest *request = (PrefetchRequest *)p_userdata;
+
+	// Build the dependency graph. Requested paths come first.
+	LocalVector<String> paths;
+	LocalVector<LocalVector<uint32_t>> dependencies;
+	HashMap<String, uint32_t> indices;
+	for (const Ref<LoadToken> &token : request->tokens) {
+		if (!indices.has(token->local_path)) {
+			indices.insert(token->local_path, paths.size());
+			paths.push_back(token->local_path);
+		}
+	}
+	const uint32_t requested_count = paths.size();
+	for (uint32_t i = 0; i < paths.size(); i++) {
+		List<String> dependency_list;
+		get_dependencies(paths[i], &dependency_list);
+		LocalVector<uint32_t> node_dependencies;
+		for (const String &E : dependency_list) {
+			const String path = _get_dependency_path(E);
+			if (path.is_empty()) {
+				continue;
+			}
+			const String local_path = _validate_local_path(path);
+			HashMap<String, uint32_t>::Iterator I = indices.find(local_path);
+			if (!I) {
+				I = indices.insert(local_path, paths.size());
+				paths.push_back(local_path);
+			}
+			if (I->value != i) {
+				node_dependencies.push_back(I->value);
+			}
+		}
+		dependencies.push_back(node_dependencies);
+	}
+
+	// Sort it so every resource comes after all the resources depending on it.
+	// A load may only await tasks newer than its own (see WorkerThreadPool::wait_for_task_completion()),
+	// so dependents must be queued first. Resources in a cycle are left out, loading
+	// their dependents will get to them.
+	LocalVector<uint32_t> dependent_count;
+	dependent_count.resize(paths.size());
+	for (uint32_t &count : dependent_count) {
+		count = 0;
+	}
+	for (const LocalVector<uint32_t> &node_dependencies : dependencies) {
+		for (uint32_t dependency : node_dependencies) {
+			dependent_count[dependency]++;
+		}
+	}
+	LocalVector<uint32_t> order;
+	for (uint32_t i = 0; i < paths.size(); i++) {
+		if (dependent_count[i] == 0) {
+			order.push_back(i);
+		}
+	}
+	for (uint32_t i = 0; i < order.size(); i++) {
+		for (uint32_t dependency : dependencies[order[i]]) {
+			if (--dependent_count[dependency] == 0) {
+				order.push_back(dependency);
+			}
+		}
+	}
+
+	// Requested paths are already queued. Leaves go to the high priority queue so
+	// they start parsing right away, the rest awaits them as it gets to them.
+	Vector<Ref<LoadToken>> dependency_tokens;
+	for (uint32_t index : order) {
+		if (index < requested_count) {
+			continue;
+		}
+		{
+			MutexLock thread_load_lock(thread_load_mutex);
+			if (cleaning_tasks) {
+				break;
+			}
+		}
+		Ref<LoadToken> token = _load_start(paths[index], "", LOAD_THREAD_DISTRIBUTE, ResourceFormatLoader::CACHE_MODE_REUSE, false, request->high_priority || dependencies[index].is_empty());
+		if (token.is_valid()) {
+			dependency_tokens.push_back(token);
+		}
+	}
+
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		for (const Ref<LoadToken> &token : request->tokens) {
+			token->prefetched_dependencies.append_array(dependency_tokens);
+		}
+	}
+
+	// Read ahead the files still pending, deepest first, so their data is
+	// already in memory by the time the workers get to parse them.
+	const uint64_t READ_AHEAD_CHUNK = 65536;
+	uint8_t *chunk = (uint8_t *)memalloc(READ_AHEAD_CHUNK);
+	for (int64_t i = int64_t(order.size()) - 1; i >= 0; i--) {
+		const String &local_path = paths[order[i]];
+		{
+			MutexLock thread_load_lock(thread_load_mutex);
+			if (cleaning_tasks) {
+				break;
+			}
+			HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(local_path);
+			if (!E || E->value.status != THREAD_LOAD_IN_PROGRESS) {
+				continue;
+			}
+		}
+		Ref<FileAccess> f = FileAccess::open(import_remap(_path_remap(local_path)), FileAccess::READ);
+		if (f.is_null()) {
+			continue;
+		}
+		uint64_t read = READ_AHEAD_CHUNK;
+		while (read == READ_AHEAD_CHUNK) {
+			read = f->get_buffer(chunk, READ_AHEAD_CHUNK);
+		}
+	}
+	memfree(chunk);
+
+	memdelete(request);
+}
+
 Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error) {
 	if (r_error) {
 		*r_error = OK;
@@ -566,7 +729,7 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	return res;
 }
 
-Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user) {
+Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user, bool p_high_priority) {
 	String local_path = _validate_local_path(p_path);
 
 	bool ignoring_cache = p_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE || p_cache_mode == ResourceFormatLoader::CACHE_MODE_IGNORE_DEEP;
@@ -654,7 +817,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 				load_task_ptr->thread_id = Thread::get_caller_id();
 			}
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr);
+			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_run_load_task, load_task_ptr, p_high_priority);
 		}
 	} // MutexLock(thread_load_mutex).
 
@@ -731,6 +894,7 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	}
 
 	Ref<Resource> res;
+	Vector<Ref<LoadToken>> prefetched_dependencies; // Released after unlocking, since that may await their tasks.
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 
@@ -765,6 +929,8 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 		if (load_token->user_rc == 0) {
 			load_token->user_path.clear();
 			user_load_tokens.erase(p_path);
+			prefetched_dependencies = load_token->prefetched_dependencies;
+			load_token->prefetched_dependencies.clear();
 			if (load_token->unreference()) {
 				memdelete(load_token);
 				load_token = nullptr;
@@ -134,6 +134,7 @@ public:
 		String user_path;
 		uint32_t user_rc = 0; // Having user RC implies regular RC incremented in one, until the user RC reaches zero.
 		ThreadLoadTask *task_if_unregistered = nullptr;
+		Vector<Ref<LoadToken>> prefetched_dependencies; // Keeps prefetched dependencies cached until this load is collected.
 
 		void clear();
 
@@ -142,7 +143,7 @@ public:
 
 	static const int BINARY_MUTEX_TAG = 1;
 
-	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user = false);
+	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, bool p_for_user = false, bool p_high_priority = false);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
 
 private:
@@ -207,6 +208,14 @@ private:
 
 	static void _run_load_task(void *p_userdata);
 
+	struct PrefetchRequest {
+		LocalVector<Ref<LoadToken>> tokens;
+		bool high_priority = false;
+	};
+
+	static void _run_prefetch_request(void *p_userdata);
+	static String _get_dependency_path(const String &p_dependency);
+
 	static thread_local bool import_thread;
 	static thread_local int load_nesting;
 	static thread_local HashMap<int, HashMap<String, Ref<Resource>>> res_ref_overrides; // Outermost key is nesting level.
@@ -231,6 +240,7 @@ public:
 	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_prefetch(const Vector<String> &p_paths, bool p_high_priority = false);
 
 	static bool is_within_load() { return load_nesting > 0; }
 
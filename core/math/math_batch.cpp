@@ -0,0 +1,636 @@
+/**************************************************************************/
+/*  math_batch.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "math_batch.h"
+
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_BATCH_SSE2
+#include <emmintrin.h>
+#if defined(__AVX2__) || defined(__FMA__)
+#include <immintrin.h>
+#endif
+// The AVX2 kernels use FMA too. MSVC has no __FMA__, but also needs no target option for the intrinsics.
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define MATH_BATCH_AVX2
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define MATH_BATCH_NEON
+#include <arm_neon.h>
+#endif
+#endif // REAL_T_IS_DOUBLE
+
+#if defined(MATH_BATCH_SSE2) || defined(MATH_BATCH_NEON)
+#define MATH_BATCH_SIMD
+
+// The kernels reinterpret these as plain float arrays.
+static_assert(sizeof(Vector3) == 3 * sizeof(float));
+static_assert(sizeof(Transform3D) == 12 * sizeof(float));
+static_assert(sizeof(AABB) == 6 * sizeof(float));
+#endif
+
+/* 4-wide float helpers, so each kernel is written once for SSE2 and NEON. */
+
+#ifdef MATH_BATCH_SSE2
+
+typedef __m128 F4;
+
+static _FORCE_INLINE_ F4 f4_load(const float *p_src) {
+	return _mm_loadu_ps(p_src);
+}
+
+static _FORCE_INLINE_ void f4_store(float *p_dst, F4 p_v) {
+	_mm_storeu_ps(p_dst, p_v);
+}
+
+// Stores the first three lanes only.
+static _FORCE_INLINE_ void f4_store3(float *p_dst, F4 p_v) {
+	_mm_storel_pi(reinterpret_cast<__m64 *>(p_dst), p_v);
+	_mm_store_ss(p_dst + 2, _mm_shuffle_ps(p_v, p_v, _MM_SHUFFLE(2, 2, 2, 2)));
+}
+
+static _FORCE_INLINE_ F4 f4_set(float p_x, float p_y, float p_z, float p_w) {
+	return _mm_setr_ps(p_x, p_y, p_z, p_w);
+}
+
+static _FORCE_INLINE_ F4 f4_splat(float p_v) {
+	return _mm_set1_ps(p_v);
+}
+
+static _FORCE_INLINE_ F4 f4_add(F4 p_a, F4 p_b) {
+	return _mm_add_ps(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_sub(F4 p_a, F4 p_b) {
+	return _mm_sub_ps(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_mul(F4 p_a, F4 p_b) {
+	return _mm_mul_ps(p_a, p_b);
+}
+
+// p_a * p_b + p_c.
+static _FORCE_INLINE_ F4 f4_madd(F4 p_a, F4 p_b, F4 p_c) {
+#ifdef __FMA__
+	return _mm_fmadd_ps(p_a, p_b, p_c);
+#else
+	return _mm_add_ps(_mm_mul_ps(p_a, p_b), p_c);
+#endif
+}
+
+static _FORCE_INLINE_ F4 f4_min(F4 p_a, F4 p_b) {
+	return _mm_min_ps(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_max(F4 p_a, F4 p_b) {
+	return _mm_max_ps(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_abs(F4 p_v) {
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), p_v);
+}
+
+template <int I>
+static _FORCE_INLINE_ F4 f4_lane(F4 p_v) {
+	return _mm_shuffle_ps(p_v, p_v, _MM_SHUFFLE(I, I, I, I));
+}
+
+// Moves lanes 1-3 to lanes 0-2, to read the last three floats of a four float load.
+static _FORCE_INLINE_ F4 f4_shift(F4 p_v) {
+	return _mm_shuffle_ps(p_v, p_v, _MM_SHUFFLE(3, 3, 2, 1));
+}
+
+static _FORCE_INLINE_ bool f4_any_positive(F4 p_v) {
+	return _mm_movemask_ps(_mm_cmpgt_ps(p_v, _mm_setzero_ps())) != 0;
+}
+
+// Bit i set when lane i is greater than or equal to zero.
+static _FORCE_INLINE_ uint32_t f4_mask_non_negative(F4 p_v) {
+	return _mm_movemask_ps(_mm_cmpge_ps(p_v, _mm_setzero_ps()));
+}
+
+static _FORCE_INLINE_ void f4_transpose(F4 &r_a, F4 &r_b, F4 &r_c, F4 &r_d) {
+	_MM_TRANSPOSE4_PS(r_a, r_b, r_c, r_d);
+}
+
+// Loads four consecutive Vector3 as one register per component.
+static _FORCE_INLINE_ void f4_load_vector3x4(const float *p_src, F4 &r_x, F4 &r_y, F4 &r_z) {
+	const F4 a = _mm_loadu_ps(p_src); // x0 y0 z0 x1
+	const F4 b = _mm_loadu_ps(p_src + 4); // y1 z1 x2 y2
+	const F4 c = _mm_loadu_ps(p_src + 8); // z2 x3 y3 z3
+	r_x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+	r_y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	r_z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+static _FORCE_INLINE_ void f4_store_vector3x4(float *p_dst, F4 p_x, F4 p_y, F4 p_z) {
+	_mm_storeu_ps(p_dst, _mm_shuffle_ps(_mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(p_z, p_x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p_dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(p_y, p_z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(p_dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(p_z, p_x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(p_y, p_z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+#elif defined(MATH_BATCH_NEON)
+
+typedef float32x4_t F4;
+
+static _FORCE_INLINE_ F4 f4_load(const float *p_src) {
+	return vld1q_f32(p_src);
+}
+
+static _FORCE_INLINE_ void f4_store(float *p_dst, F4 p_v) {
+	vst1q_f32(p_dst, p_v);
+}
+
+// Stores the first three lanes only.
+static _FORCE_INLINE_ void f4_store3(float *p_dst, F4 p_v) {
+	vst1_f32(p_dst, vget_low_f32(p_v));
+	vst1q_lane_f32(p_dst + 2, p_v, 2);
+}
+
+static _FORCE_INLINE_ F4 f4_set(float p_x, float p_y, float p_z, float p_w) {
+	const float v[4] = { p_x, p_y, p_z, p_w };
+	return vld1q_f32(v);
+}
+
+static _FORCE_INLINE_ F4 f4_splat(float p_v) {
+	return vdupq_n_f32(p_v);
+}
+
+static _FORCE_INLINE_ F4 f4_add(F4 p_a, F4 p_b) {
+	return vaddq_f32(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_sub(F4 p_a, F4 p_b) {
+	return vsubq_f32(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_mul(F4 p_a, F4 p_b) {
+	return vmulq_f32(p_a, p_b);
+}
+
+// p_a * p_b + p_c.
+static _FORCE_INLINE_ F4 f4_madd(F4 p_a, F4 p_b, F4 p_c) {
+	return vmlaq_f32(p_c, p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_min(F4 p_a, F4 p_b) {
+	return vminq_f32(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_max(F4 p_a, F4 p_b) {
+	return vmaxq_f32(p_a, p_b);
+}
+
+static _FORCE_INLINE_ F4 f4_abs(F4 p_v) {
+	return vabsq_f32(p_v);
+}
+
+template <int I>
+static _FORCE_INLINE_ F4 f4_lane(F4 p_v) {
+	return vdupq_n_f32(vgetq_lane_f32(p_v, I));
+}
+
+// Moves lanes 1-3 to lanes 0-2, to read the last three floats of a four float load.
+static _FORCE_INLINE_ F4 f4_shift(F4 p_v) {
+	return vextq_f32(p_v, p_v, 1);
+}
+
+static _FORCE_INLINE_ bool f4_any_positive(F4 p_v) {
+	const uint32x4_t mask = vcgtq_f32(p_v, vdupq_n_f32(0.0f));
+	const uint32x2_t folded = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+	return (vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) != 0;
+}
+
+static _FORCE_INLINE_ uint32_t f4_mask_non_negative(F4 p_v) {
+	static const uint32_t bits[4] = { 1, 2, 4, 8 };
+	const uint32x4_t mask = vandq_u32(vcgeq_f32(p_v, vdupq_n_f32(0.0f)), vld1q_u32(bits));
+	const uint32x2_t folded = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+	return vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1);
+}
+
+static _FORCE_INLINE_ void f4_transpose(F4 &r_a, F4 &r_b, F4 &r_c, F4 &r_d) {
+	const float32x4x2_t ab = vtrnq_f32(r_a, r_b);
+	const float32x4x2_t cd = vtrnq_f32(r_c, r_d);
+	r_a = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+	r_b = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+	r_c = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+	r_d = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+}
+
+// Loads four consecutive Vector3 as one register per component.
+static _FORCE_INLINE_ void f4_load_vector3x4(const float *p_src, F4 &r_x, F4 &r_y, F4 &r_z) {
+	const float32x4x3_t v = vld3q_f32(p_src);
+	r_x = v.val[0];
+	r_y = v.val[1];
+	r_z = v.val[2];
+}
+
+static _FORCE_INLINE_ void f4_store_vector3x4(float *p_dst, F4 p_x, F4 p_y, F4 p_z) {
+	float32x4x3_t v;
+	v.val[0] = p_x;
+	v.val[1] = p_y;
+	v.val[2] = p_z;
+	vst3q_f32(p_dst, v);
+}
+
+#endif
+
+#ifdef MATH_BATCH_SIMD
+// Basis columns and origin as registers, the 4th lane is unused.
+struct F4Transform {
+	F4 columns[3];
+	F4 origin;
+
+	explicit F4Transform(const Transform3D &p_transform) {
+		const Basis &b = p_transform.basis;
+		columns[0] = f4_set(b.rows[0][0], b.rows[1][0], b.rows[2][0], 0.0f);
+		columns[1] = f4_set(b.rows[0][1], b.rows[1][1], b.rows[2][1], 0.0f);
+		columns[2] = f4_set(b.rows[0][2], b.rows[1][2], b.rows[2][2], 0.0f);
+		origin = f4_set(p_transform.origin.x, p_transform.origin.y, p_transform.origin.z, 0.0f);
+	}
+	F4Transform() {}
+};
+
+// Loads a Transform3D from memory, without reading past its end.
+static _FORCE_INLINE_ F4Transform f4_load_transform(const float *p_src) {
+	F4Transform t;
+	F4 row0 = f4_load(p_src);
+	F4 row1 = f4_load(p_src + 3);
+	F4 row2 = f4_load(p_src + 6);
+	t.origin = f4_shift(f4_load(p_src + 8));
+	F4 unused = t.origin;
+	f4_transpose(row0, row1, row2, unused);
+	t.columns[0] = row0;
+	t.columns[1] = row1;
+	t.columns[2] = row2;
+	return t;
+}
+
+// Transforms an AABB given as center and half extents (Arvo's method).
+static _FORCE_INLINE_ void f4_transform_box(const F4Transform &p_transform, F4 p_center, F4 p_half, F4 &r_center, F4 &r_half) {
+	r_center = f4_madd(p_transform.columns[0], f4_lane<0>(p_center), f4_madd(p_transform.columns[1], f4_lane<1>(p_center), f4_madd(p_transform.columns[2], f4_lane<2>(p_center), p_transform.origin)));
+	r_half = f4_madd(f4_abs(p_transform.columns[0]), f4_lane<0>(p_half), f4_madd(f4_abs(p_transform.columns[1]), f4_lane<1>(p_half), f4_mul(f4_abs(p_transform.columns[2]), f4_lane<2>(p_half))));
+}
+
+// Loads an AABB as center and half extents, without reading past its end.
+static _FORCE_INLINE_ void f4_load_box(const float *p_src, F4 &r_center, F4 &r_half) {
+	r_half = f4_mul(f4_shift(f4_load(p_src + 2)), f4_splat(0.5f));
+	r_center = f4_add(f4_load(p_src), r_half);
+}
+#endif
+
+#ifdef MATH_BATCH_AVX2
+// Loads eight consecutive Vector3 as one register per component. Each 128-bit lane holds four of them,
+// so the in-lane shuffles are the same as for SSE.
+static _FORCE_INLINE_ void f8_load_vector3x8(const float *p_src, __m256 &r_x, __m256 &r_y, __m256 &r_z) {
+	const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p_src)), _mm_loadu_ps(p_src + 12), 1);
+	const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p_src + 4)), _mm_loadu_ps(p_src + 16), 1);
+	const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p_src + 8)), _mm_loadu_ps(p_src + 20), 1);
+	r_x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+	r_y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	r_z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+static _FORCE_INLINE_ void f8_store_vector3x8(float *p_dst, __m256 p_x, __m256 p_y, __m256 p_z) {
+	const __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(p_x, p_y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(p_z, p_x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(p_y, p_z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(p_z, p_x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(p_y, p_z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+	_mm_storeu_ps(p_dst, _mm256_castps256_ps128(a));
+	_mm_storeu_ps(p_dst + 4, _mm256_castps256_ps128(b));
+	_mm_storeu_ps(p_dst + 8, _mm256_castps256_ps128(c));
+	_mm_storeu_ps(p_dst + 12, _mm256_extractf128_ps(a, 1));
+	_mm_storeu_ps(p_dst + 16, _mm256_extractf128_ps(b, 1));
+	_mm_storeu_ps(p_dst + 20, _mm256_extractf128_ps(c, 1));
+}
+#endif
+
+void MathBatch::transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) {
+	uint32_t i = 0;
+#ifdef MATH_BATCH_SIMD
+	const Basis &b = p_transform.basis;
+	const Vector3 &o = p_transform.origin;
+#ifdef MATH_BATCH_AVX2
+	{
+		const __m256 m[3][4] = {
+			{ _mm256_set1_ps(b.rows[0][0]), _mm256_set1_ps(b.rows[0][1]), _mm256_set1_ps(b.rows[0][2]), _mm256_set1_ps(o.x) },
+			{ _mm256_set1_ps(b.rows[1][0]), _mm256_set1_ps(b.rows[1][1]), _mm256_set1_ps(b.rows[1][2]), _mm256_set1_ps(o.y) },
+			{ _mm256_set1_ps(b.rows[2][0]), _mm256_set1_ps(b.rows[2][1]), _mm256_set1_ps(b.rows[2][2]), _mm256_set1_ps(o.z) },
+		};
+		for (; i + 8 <= p_count; i += 8) {
+			__m256 x, y, z;
+			f8_load_vector3x8(&p_src[i].x, x, y, z);
+			const __m256 rx = _mm256_fmadd_ps(m[0][0], x, _mm256_fmadd_ps(m[0][1], y, _mm256_fmadd_ps(m[0][2], z, m[0][3])));
+			const __m256 ry = _mm256_fmadd_ps(m[1][0], x, _mm256_fmadd_ps(m[1][1], y, _mm256_fmadd_ps(m[1][2], z, m[1][3])));
+			const __m256 rz = _mm256_fmadd_ps(m[2][0], x, _mm256_fmadd_ps(m[2][1], y, _mm256_fmadd_ps(m[2][2], z, m[2][3])));
+			f8_store_vector3x8(&r_dst[i].x, rx, ry, rz);
+		}
+	}
+#endif
+	const F4 m[3][4] = {
+		{ f4_splat(b.rows[0][0]), f4_splat(b.rows[0][1]), f4_splat(b.rows[0][2]), f4_splat(o.x) },
+		{ f4_splat(b.rows[1][0]), f4_splat(b.rows[1][1]), f4_splat(b.rows[1][2]), f4_splat(o.y) },
+		{ f4_splat(b.rows[2][0]), f4_splat(b.rows[2][1]), f4_splat(b.rows[2][2]), f4_splat(o.z) },
+	};
+	for (; i + 4 <= p_count; i += 4) {
+		F4 x, y, z;
+		f4_load_vector3x4(&p_src[i].x, x, y, z);
+		const F4 rx = f4_madd(m[0][0], x, f4_madd(m[0][1], y, f4_madd(m[0][2], z, m[0][3])));
+		const F4 ry = f4_madd(m[1][0], x, f4_madd(m[1][1], y, f4_madd(m[1][2], z, m[1][3])));
+		const F4 rz = f4_madd(m[2][0], x, f4_madd(m[2][1], y, f4_madd(m[2][2], z, m[2][3])));
+		f4_store_vector3x4(&r_dst[i].x, rx, ry, rz);
+	}
+#endif
+	for (; i < p_count; i++) {
+		r_dst[i] = p_transform.xform(p_src[i]);
+	}
+}
+
+void MathBatch::multiply_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD
+	// Each result row is a combination of the child's basis rows, the origin one of the parent's columns.
+	const Basis &b = p_parent.basis;
+	const F4 p[3][3] = {
+		{ f4_splat(b.rows[0][0]), f4_splat(b.rows[0][1]), f4_splat(b.rows[0][2]) },
+		{ f4_splat(b.rows[1][0]), f4_splat(b.rows[1][1]), f4_splat(b.rows[1][2]) },
+		{ f4_splat(b.rows[2][0]), f4_splat(b.rows[2][1]), f4_splat(b.rows[2][2]) },
+	};
+	const F4Transform parent(p_parent);
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const float *src = &p_src[i].basis.rows[0].x;
+		const F4 row0 = f4_load(src);
+		const F4 row1 = f4_load(src + 3);
+		const F4 row2 = f4_load(src + 6);
+		const F4 origin = f4_shift(f4_load(src + 8));
+
+		const F4 r0 = f4_madd(p[0][0], row0, f4_madd(p[0][1], row1, f4_mul(p[0][2], row2)));
+		const F4 r1 = f4_madd(p[1][0], row0, f4_madd(p[1][1], row1, f4_mul(p[1][2], row2)));
+		const F4 r2 = f4_madd(p[2][0], row0, f4_madd(p[2][1], row1, f4_mul(p[2][2], row2)));
+		const F4 o = f4_madd(parent.columns[0], f4_lane<0>(origin), f4_madd(parent.columns[1], f4_lane<1>(origin), f4_madd(parent.columns[2], f4_lane<2>(origin), parent.origin)));
+
+		// In order, each store overwrites the extra lane of the previous one.
+		float *dst = &r_dst[i].basis.rows[0].x;
+		f4_store(dst, r0);
+		f4_store(dst + 3, r1);
+		f4_store(dst + 6, r2);
+		f4_store3(dst + 9, o);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_parent * p_src[i];
+	}
+#endif
+}
+
+void MathBatch::transform_aabbs(const Transform3D *p_transforms, const AABB *p_src, AABB *r_dst, uint32_t p_count) {
+#ifdef MATH_BATCH_SIMD
+	for (uint32_t i = 0; i < p_count; i++) {
+		const F4Transform transform = f4_load_transform(&p_transforms[i].basis.rows[0].x);
+		F4 center, half;
+		f4_load_box(&p_src[i].position.x, center, half);
+		f4_transform_box(transform, center, half, center, half);
+
+		float *dst = &r_dst[i].position.x;
+		f4_store(dst, f4_sub(center, half));
+		f4_store3(dst + 3, f4_add(half, half));
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_transforms[i].xform(p_src[i]);
+	}
+#endif
+}
+
+AABB MathBatch::transform_and_merge_aabbs(const Transform3D &p_transform, const AABB *p_src, uint32_t p_count) {
+	if (p_count == 0) {
+		return AABB();
+	}
+#ifdef MATH_BATCH_SIMD
+	const F4Transform transform(p_transform);
+	F4 min = f4_splat(INFINITY);
+	F4 max = f4_splat(-INFINITY);
+	for (uint32_t i = 0; i < p_count; i++) {
+		F4 center, half;
+		f4_load_box(&p_src[i].position.x, center, half);
+		f4_transform_box(transform, center, half, center, half);
+		min = f4_min(min, f4_sub(center, half));
+		max = f4_max(max, f4_add(center, half));
+	}
+
+	float result[8];
+	f4_store(result, min);
+	f4_store(result + 4, max);
+	return AABB(Vector3(result[0], result[1], result[2]), Vector3(result[4] - result[0], result[5] - result[1], result[6] - result[2]));
+#else
+	AABB aabb = p_transform.xform(p_src[0]);
+	for (uint32_t i = 1; i < p_count; i++) {
+		aabb.merge_with(p_transform.xform(p_src[i]));
+	}
+	return aabb;
+#endif
+}
+
+AABB MathBatch::merge_transformed_aabb(const AABB &p_aabb, const float *p_transforms, uint32_t p_stride, uint32_t p_count) {
+	if (p_count == 0) {
+		return AABB();
+	}
+#ifdef MATH_BATCH_SIMD
+	const F4 half = f4_set(p_aabb.size.x * 0.5f, p_aabb.size.y * 0.5f, p_aabb.size.z * 0.5f, 0.0f);
+	const F4 center = f4_add(f4_set(p_aabb.position.x, p_aabb.position.y, p_aabb.position.z, 0.0f), half);
+	F4 min = f4_splat(INFINITY);
+	F4 max = f4_splat(-INFINITY);
+	for (uint32_t i = 0; i < p_count; i++) {
+		const float *data = p_transforms + size_t(p_stride) * i;
+		F4Transform transform;
+		transform.columns[0] = f4_load(data);
+		transform.columns[1] = f4_load(data + 4);
+		transform.columns[2] = f4_load(data + 8);
+		transform.origin = f4_splat(0.0f);
+		f4_transpose(transform.columns[0], transform.columns[1], transform.columns[2], transform.origin);
+
+		F4 c, h;
+		f4_transform_box(transform, center, half, c, h);
+		min = f4_min(min, f4_sub(c, h));
+		max = f4_max(max, f4_add(c, h));
+	}
+
+	float result[8];
+	f4_store(result, min);
+	f4_store(result + 4, max);
+	return AABB(Vector3(result[0], result[1], result[2]), Vector3(result[4] - result[0], result[5] - result[1], result[6] - result[2]));
+#else
+	AABB aabb;
+	for (uint32_t i = 0; i < p_count; i++) {
+		const float *data = p_transforms + size_t(p_stride) * i;
+		Transform3D t;
+		t.basis.rows[0] = Vector3(data[0], data[1], data[2]);
+		t.basis.rows[1] = Vector3(data[4], data[5], data[6]);
+		t.basis.rows[2] = Vector3(data[8], data[9], data[10]);
+		t.origin = Vector3(data[3], data[7], data[11]);
+		if (i == 0) {
+			aabb = t.xform(p_aabb);
+		} else {
+			aabb.merge_with(t.xform(p_aabb));
+		}
+	}
+	return aabb;
+#endif
+}
+
+uint32_t MathBatch::cull_aabbs(const Plane *p_planes, uint32_t p_plane_count, const AABB *p_aabbs, uint32_t p_count, uint8_t *r_inside) {
+	uint32_t inside_count = 0;
+
+#ifdef MATH_BATCH_SIMD
+	// Planes are laid out by component, a group of lanes per register. Padding planes can never reject.
+#ifdef MATH_BATCH_AVX2
+	const uint32_t LANES = 8;
+#else
+	const uint32_t LANES = 4;
+#endif
+	const uint32_t MAX_PLANES = 32;
+	if (p_plane_count <= MAX_PLANES) {
+		const uint32_t group_count = (p_plane_count + LANES - 1) / LANES;
+		float planes[4][MAX_PLANES];
+		for (uint32_t i = 0; i < group_count * LANES; i++) {
+			if (i < p_plane_count) {
+				const Plane &p = p_planes[i];
+				planes[0][i] = p.normal.x;
+				planes[1][i] = p.normal.y;
+				planes[2][i] = p.normal.z;
+				planes[3][i] = p.d;
+			} else {
+				planes[0][i] = 0.0f;
+				planes[1][i] = 0.0f;
+				planes[2][i] = 0.0f;
+				planes[3][i] = INFINITY;
+			}
+		}
+
+		for (uint32_t i = 0; i < p_count; i++) {
+			const AABB &aabb = p_aabbs[i];
+			const Vector3 half = aabb.size * 0.5f;
+			const Vector3 center = aabb.position + half;
+
+			// Outside a plane when even the corner furthest in the normal's opposite direction is in front of it.
+			bool inside = true;
+#ifdef MATH_BATCH_AVX2
+			const __m256 cx = _mm256_set1_ps(center.x), cy = _mm256_set1_ps(center.y), cz = _mm256_set1_ps(center.z);
+			const __m256 hx = _mm256_set1_ps(half.x), hy = _mm256_set1_ps(half.y), hz = _mm256_set1_ps(half.z);
+			const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+			for (uint32_t g = 0; g < group_count && inside; g++) {
+				const __m256 nx = _mm256_loadu_ps(&planes[0][g * LANES]);
+				const __m256 ny = _mm256_loadu_ps(&planes[1][g * LANES]);
+				const __m256 nz = _mm256_loadu_ps(&planes[2][g * LANES]);
+				const __m256 d = _mm256_loadu_ps(&planes[3][g * LANES]);
+				const __m256 dist = _mm256_fmadd_ps(nx, cx, _mm256_fmadd_ps(ny, cy, _mm256_fmsub_ps(nz, cz, d)));
+				const __m256 extent = _mm256_fmadd_ps(_mm256_andnot_ps(sign_mask, nx), hx, _mm256_fmadd_ps(_mm256_andnot_ps(sign_mask, ny), hy, _mm256_mul_ps(_mm256_andnot_ps(sign_mask, nz), hz)));
+				inside = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_sub_ps(dist, extent), _mm256_setzero_ps(), _CMP_GT_OQ)) == 0;
+			}
+#else
+			const F4 cx = f4_splat(center.x), cy = f4_splat(center.y), cz = f4_splat(center.z);
+			const F4 hx = f4_splat(half.x), hy = f4_splat(half.y), hz = f4_splat(half.z);
+			for (uint32_t g = 0; g < group_count && inside; g++) {
+				const F4 nx = f4_load(&planes[0][g * LANES]);
+				const F4 ny = f4_load(&planes[1][g * LANES]);
+				const F4 nz = f4_load(&planes[2][g * LANES]);
+				const F4 d = f4_load(&planes[3][g * LANES]);
+				const F4 dist = f4_sub(f4_madd(nx, cx, f4_madd(ny, cy, f4_mul(nz, cz))), d);
+				const F4 extent = f4_madd(f4_abs(nx), hx, f4_madd(f4_abs(ny), hy, f4_mul(f4_abs(nz), hz)));
+				inside = !f4_any_positive(f4_sub(dist, extent));
+			}
+#endif
+			r_inside[i] = inside;
+			inside_count += inside;
+		}
+		return inside_count;
+	}
+#endif
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		const AABB &aabb = p_aabbs[i];
+		const Vector3 half = aabb.size * 0.5f;
+		const Vector3 center = aabb.position + half;
+		bool inside = true;
+		for (uint32_t j = 0; j < p_plane_count && inside; j++) {
+			const Plane &p = p_planes[j];
+			inside = p.normal.dot(center) - p.d - p.normal.abs().dot(half) <= 0;
+		}
+		r_inside[i] = inside;
+		inside_count += inside;
+	}
+	return inside_count;
+}
+
+uint32_t MathBatch::cull_bounds_pack(const Plane *p_planes, uint32_t p_plane_count, const BoundsPack &p_pack) {
+	const uint32_t all = (1u << BoundsPack::SIZE) - 1;
+	uint32_t outside = 0;
+
+	for (uint32_t i = 0; i < p_plane_count && outside != all; i++) {
+		const Plane &p = p_planes[i];
+		// The corner furthest in the opposite direction of the normal is the same for every box,
+		// so each plane only has to pick which half of the pack to read per axis.
+		const real_t *x = p.normal.x > 0 ? p_pack.min_x : p_pack.max_x;
+		const real_t *y = p.normal.y > 0 ? p_pack.min_y : p_pack.max_y;
+		const real_t *z = p.normal.z > 0 ? p_pack.min_z : p_pack.max_z;
+
+#if defined(MATH_BATCH_AVX2)
+		const __m256 dist = _mm256_fmadd_ps(_mm256_set1_ps(p.normal.x), _mm256_loadu_ps(x),
+				_mm256_fmadd_ps(_mm256_set1_ps(p.normal.y), _mm256_loadu_ps(y),
+						_mm256_fmsub_ps(_mm256_set1_ps(p.normal.z), _mm256_loadu_ps(z), _mm256_set1_ps(p.d))));
+		outside |= _mm256_movemask_ps(_mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_GE_OQ));
+#elif defined(MATH_BATCH_SIMD)
+		const F4 nx = f4_splat(p.normal.x), ny = f4_splat(p.normal.y), nz = f4_splat(p.normal.z), d = f4_splat(p.d);
+		for (uint32_t j = 0; j < BoundsPack::SIZE; j += 4) {
+			const F4 dist = f4_sub(f4_madd(nx, f4_load(x + j), f4_madd(ny, f4_load(y + j), f4_mul(nz, f4_load(z + j)))), d);
+			outside |= f4_mask_non_negative(dist) << j;
+		}
+#else
+		for (uint32_t j = 0; j < BoundsPack::SIZE; j++) {
+			outside |= uint32_t(p.normal.x * x[j] + p.normal.y * y[j] + p.normal.z * z[j] - p.d >= 0) << j;
+		}
+#endif
+	}
+
+	return ~outside & all;
+}
+
+const char *MathBatch::get_simd_name() {
+#if defined(MATH_BATCH_AVX2)
+	return "AVX2";
+#elif defined(MATH_BATCH_SSE2)
+	return "SSE2";
+#elif defined(MATH_BATCH_NEON)
+	return "NEON";
+#else
+	return "Scalar";
+#endif
+}
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  math_batch.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef MATH_BATCH_H
+#define MATH_BATCH_H
+
+#include "core/math/aabb.h"
+#include "core/math/plane.h"
+#include "core/math/transform_3d.h"
+
+// Batched versions of the Transform3D, AABB and Plane operations, for code that loops over many elements.
+// Kernels use SSE2 (AVX2/FMA when the build targets them) on x86 and NEON on ARM, with a scalar fallback,
+// which is also what double-precision builds use.
+class MathBatch {
+public:
+	// Bounds of up to SIZE boxes in structure-of-arrays order, for cull_bounds_pack().
+	struct BoundsPack {
+		static constexpr uint32_t SIZE = 8;
+
+		real_t min_x[SIZE];
+		real_t min_y[SIZE];
+		real_t min_z[SIZE];
+		real_t max_x[SIZE];
+		real_t max_y[SIZE];
+		real_t max_z[SIZE];
+
+		_FORCE_INLINE_ void set(uint32_t p_lane, const Vector3 &p_min, const Vector3 &p_max) {
+			min_x[p_lane] = p_min.x;
+			min_y[p_lane] = p_min.y;
+			min_z[p_lane] = p_min.z;
+			max_x[p_lane] = p_max.x;
+			max_y[p_lane] = p_max.y;
+			max_z[p_lane] = p_max.z;
+		}
+	};
+
+	// r_dst[i] = p_transform.xform(p_src[i]). p_src and r_dst may be the same array.
+	static void transform_points(const Transform3D &p_transform, const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count);
+
+	// r_dst[i] = p_parent * p_src[i]. p_src and r_dst may be the same array.
+	static void multiply_transforms(const Transform3D &p_parent, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count);
+
+	// r_dst[i] = p_transforms[i].xform(p_src[i]). p_src and r_dst may be the same array.
+	static void transform_aabbs(const Transform3D *p_transforms, const AABB *p_src, AABB *r_dst, uint32_t p_count);
+
+	// Merge of p_transform.xform(p_src[i]) for all i. Returns an empty AABB if p_count is zero.
+	static AABB transform_and_merge_aabbs(const Transform3D &p_transform, const AABB *p_src, uint32_t p_count);
+
+	// Merge of p_aabb transformed by each of p_count row-major 3x4 float matrices (the MultiMesh buffer layout),
+	// the first one at p_transforms and each next one p_stride floats after the previous.
+	static AABB merge_transformed_aabb(const AABB &p_aabb, const float *p_transforms, uint32_t p_stride, uint32_t p_count);
+
+	// Sets r_inside[i] to 0 if p_aabbs[i] is fully outside any of the planes (normals pointing outwards),
+	// and to 1 otherwise. Returns how many are inside.
+	static uint32_t cull_aabbs(const Plane *p_planes, uint32_t p_plane_count, const AABB *p_aabbs, uint32_t p_count, uint8_t *r_inside);
+
+	// Returns a mask with bit i set unless box i of p_pack is fully outside any of the planes (normals pointing outwards).
+	// Unlike cull_aabbs(), a box whose nearest corner lies exactly on a plane counts as outside.
+	static uint32_t cull_bounds_pack(const Plane *p_planes, uint32_t p_plane_count, const BoundsPack &p_pack);
+
+	// Name of the instruction set the kernels were built for.
+	static const char *get_simd_name();
+};
+
+#endif // MATH_BATCH_H
@@ -84,7 +84,7 @@ struct [[nodiscard]] Transform3D {
 
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ AABB xform(const AABB &p_aabb) const;
-	_FORCE_INLINE_ Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
+	Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
 
 	// NOTE: These are UNSAFE with non-uniform scaling, and will produce incorrect results.
 	// They use the transpose.
@@ -213,19 +213,6 @@ _FORCE_INLINE_ AABB Transform3D::xform_inv(const AABB &p_aabb) const {
 	return ret;
 }
 
-Vector<Vector3> Transform3D::xform(const Vector<Vector3> &p_array) const {
-	Vector<Vector3> array;
-	array.resize(p_array.size());
-
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
-	return array;
-}
-
 Vector<Vector3> Transform3D::xform_inv(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
@@ -44,21 +44,6 @@
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	ObjectID obj_id;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj_id = p_obj->get_instance_id();
-		p_obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		Object *obj_ptr = ObjectDB::get_instance(obj_id);
-		if (likely(obj_ptr)) {
-			obj_ptr->_lock_index.unref();
-		}
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1165,6 +1150,20 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+void Object::SignalData::update_emit_slots() {
+	// Emissions in flight may hold the current slots, so build new ones instead of editing them.
+	Vector<EmitSlot> new_emit_slots;
+	new_emit_slots.resize(slot_map.size());
+	EmitSlot *emit_slots_ptrw = new_emit_slots.ptrw();
+	for (const KeyValue<Callable, Slot> &slot_kv : slot_map) {
+		EmitSlot &emit_slot = *(emit_slots_ptrw++);
+		emit_slot.callable = slot_kv.value.conn.callable;
+		emit_slot.flags = slot_kv.value.conn.flags;
+		emit_slot.target = emit_slot.callable.is_custom() ? ObjectID() : emit_slot.callable.get_object_id();
+	}
+	emit_slots = new_emit_slots;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -1186,30 +1185,24 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
-
-	DEV_ASSERT(slot_count == s->slot_map.size());
+	// will not affect the signal calling. Connecting or disconnecting
+	// replaces the emit slots instead of modifying them, so holding a
+	// reference is enough, and emitting from several threads only reads them.
+	const Vector<SignalData::EmitSlot> emit_slots = s->emit_slots;
+	const SignalData::EmitSlot *slots = emit_slots.ptr();
+	const uint32_t slot_count = emit_slots.size();
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		bool disconnect = slots[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (slots[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, slots[i].callable);
 		}
 	}
 
@@ -1218,34 +1211,51 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = slots[i].callable;
+		const uint32_t &flags = slots[i].flags;
+
+		const Variant **args = p_args;
+		int argc = p_argcount;
 
-		if (!callable.is_valid()) {
+		Object *target = nullptr;
+		if (slots[i].target.is_valid() && !(flags & CONNECT_DEFERRED)) {
+			target = ObjectDB::get_instance(slots[i].target);
+			if (!target) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
+		} else if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
 
-		const Variant **args = p_args;
-		int argc = p_argcount;
-
 		if (flags & CONNECT_DEFERRED) {
 			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			callable.callp(args, argc, ret, ce);
+			if (target) {
+				// Same as Callable::callp(), with the object already looked up. Going through the
+				// virtual callp() keeps overrides such as script static functions working.
+				ret = target->callp(callable.get_method(), args, argc, ce);
+			} else {
+				callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
+			if (target && ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && !target->has_method(callable.get_method())) {
+				continue; // Skipped without an error, as a callable that is not valid would be.
+			}
+
 			if (ce.error != Callable::CallError::CALL_OK) {
 #ifdef DEBUG_ENABLED
 				if (flags & CONNECT_PERSIST && Engine::get_singleton()->is_editor_hint() && (script.is_null() || !Ref<Script>(script)->is_tool())) {
 					continue;
 				}
 #endif
-				Object *target = callable.get_object();
-				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
+				Object *target_object = callable.get_object();
+				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target_object && !ClassDB::class_exists(target_object->get_class_name())) {
 					//most likely object is not initialized yet, do not throw error.
 				} else {
 					ERR_PRINT(vformat("Error calling from signal '%s' to callable: %s.", String(p_name), Variant::get_callable_error_text(callable, args, argc, ce)));
@@ -1255,10 +1265,6 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
 	return err;
 }
 
@@ -1472,6 +1478,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->update_emit_slots();
 
 	return OK;
 }
@@ -1547,6 +1554,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->update_emit_slots();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2228,8 +2236,9 @@ void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
 	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.data.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) {
+			p_func(object_slot.object.load(std::memory_order_relaxed));
 			count--;
 		}
 	}
@@ -2285,9 +2294,20 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_pages[OBJECTDB_SLOT_PAGE_COUNT] = {};
 uint64_t ObjectDB::validator_counter = 0;
 
+#define OBJECTDB_NEXT_FREE_SHIFT OBJECTDB_VALIDATOR_BITS
+#define OBJECTDB_REF_COUNTED_SHIFT (OBJECTDB_VALIDATOR_BITS + OBJECTDB_SLOT_MAX_COUNT_BITS)
+
+static _FORCE_INLINE_ uint64_t _objectdb_slot_data(uint64_t p_validator, uint32_t p_next_free, bool p_is_ref_counted) {
+	return p_validator | (uint64_t(p_next_free) << OBJECTDB_NEXT_FREE_SHIFT) | (uint64_t(p_is_ref_counted) << OBJECTDB_REF_COUNTED_SHIFT);
+}
+
+static _FORCE_INLINE_ uint32_t _objectdb_slot_next_free(uint64_t p_data) {
+	return (p_data >> OBJECTDB_NEXT_FREE_SHIFT) & OBJECTDB_SLOT_MAX_COUNT_MASK;
+}
+
 int ObjectDB::get_object_count() {
 	return slot_count;
 }
@@ -2297,29 +2317,34 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 	if (unlikely(slot_count == slot_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		// Grow by a whole page. Existing pages stay where they are, so lock free
+		// readers never see a slot move under them.
+		ObjectSlot *page = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_SLOT_PAGE_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_PAGE_SIZE; i++) {
+			memnew_placement(&page[i].data, std::atomic<uint64_t>(_objectdb_slot_data(0, slot_max + i, false)));
+			memnew_placement(&page[i].object, std::atomic<Object *>(nullptr));
 		}
-		slot_max = new_slot_max;
+		slot_pages[slot_max >> OBJECTDB_SLOT_PAGE_BITS].store(page, std::memory_order_release);
+		slot_max += OBJECTDB_SLOT_PAGE_SIZE;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	ObjectSlot &free_slot = _get_slot(slot_count);
+	uint32_t slot = _objectdb_slot_next_free(free_slot.data.load(std::memory_order_relaxed));
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
+
+	// Publish the object before the validator, readers check the validator first.
+	// Release, so a reader that sees the new object also sees the previous validator was cleared.
+	object_slot.object.store(p_object, std::memory_order_release);
+	uint32_t next_free = _objectdb_slot_next_free(object_slot.data.load(std::memory_order_relaxed));
+	object_slot.data.store(_objectdb_slot_data(validator_counter, next_free, p_object->is_ref_counted()), std::memory_order_release);
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -2342,17 +2367,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if ((object_slot.data.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_COND((object_slot.data.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator);
 		}
 	}
 
@@ -2360,11 +2387,14 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	ObjectSlot &free_slot = _get_slot(slot_count);
+	uint64_t free_data = free_slot.data.load(std::memory_order_relaxed);
+	free_data &= ~(OBJECTDB_SLOT_MAX_COUNT_MASK << OBJECTDB_NEXT_FREE_SHIFT);
+	free_slot.data.store(free_data | (uint64_t(slot) << OBJECTDB_NEXT_FREE_SHIFT), std::memory_order_relaxed);
+	//invalidate, so checks against it fail, before clearing the object
+	uint32_t next_free = _objectdb_slot_next_free(object_slot.data.load(std::memory_order_relaxed));
+	object_slot.data.store(_objectdb_slot_data(0, next_free, false), std::memory_order_relaxed);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
 	spin_lock.unlock();
 }
@@ -2387,8 +2417,10 @@ void ObjectDB::cleanup() {
 			Callable::CallError call_error;
 
 			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+				ObjectSlot &object_slot = _get_slot(i);
+				uint64_t data = object_slot.data.load(std::memory_order_relaxed);
+				if (data & OBJECTDB_VALIDATOR_MASK) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2398,7 +2430,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | ((data & OBJECTDB_VALIDATOR_MASK) << OBJECTDB_SLOT_MAX_COUNT_BITS) | ((data >> OBJECTDB_REF_COUNTED_SHIFT) ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2409,9 +2441,12 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	// Only freed here, once nothing can look instances up anymore.
+	for (uint32_t i = 0; i < slot_max >> OBJECTDB_SLOT_PAGE_BITS; i++) {
+		memfree(slot_pages[i].load(std::memory_order_relaxed));
+		slot_pages[i].store(nullptr, std::memory_order_relaxed);
 	}
+	slot_max = 0;
 
 	spin_lock.unlock();
 }
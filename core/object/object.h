@@ -619,9 +619,22 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// What emit_signalp() needs from each connection. Rebuilt whenever the connections
+		// change, and never modified, so emissions in flight can keep using it.
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
+			// Set for plain method callables, so emission can call the target directly
+			// instead of checking the callable first.
+			ObjectID target;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		Vector<EmitSlot> emit_slots;
 		bool removable = false;
+
+		void update_emit_slots();
 	};
 
 	HashMap<StringName, SignalData> signal_map;
@@ -1017,19 +1030,30 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+// Slots live in fixed-size pages that are never moved or freed while the engine runs,
+// so readers can look them up without taking the lock.
+#define OBJECTDB_SLOT_PAGE_BITS 12
+#define OBJECTDB_SLOT_PAGE_SIZE (uint32_t(1) << OBJECTDB_SLOT_PAGE_BITS)
+#define OBJECTDB_SLOT_PAGE_MASK (OBJECTDB_SLOT_PAGE_SIZE - 1)
+#define OBJECTDB_SLOT_PAGE_COUNT (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_PAGE_BITS))
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Validator in the low bits, then next_free, then is_ref_counted in the top bit.
+		// Only written with the spin lock held, always as a whole word.
+		std::atomic<uint64_t> data;
+		std::atomic<Object *> object;
 	};
 
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<ObjectSlot *> slot_pages[OBJECTDB_SLOT_PAGE_COUNT];
 	static uint64_t validator_counter;
 
+	_FORCE_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_pages[p_slot >> OBJECTDB_SLOT_PAGE_BITS].load(std::memory_order_relaxed)[p_slot & OBJECTDB_SLOT_PAGE_MASK];
+	}
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1043,24 +1067,31 @@ class ObjectDB {
 public:
 	typedef void (*DebugFunc)(Object *p_obj);
 
+	// Lock free. Writers publish the object before the validator and clear the
+	// validator before the object, and validators are never reused, so reading
+	// the same validator before and after the object means the object belongs to the ID.
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		const ObjectSlot *page = slot_pages[slot >> OBJECTDB_SLOT_PAGE_BITS].load(std::memory_order_acquire);
+		ERR_FAIL_NULL_V(page, nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		if (unlikely(validator == 0)) {
+			return nullptr; // Free slots have a zero validator.
+		}
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		const ObjectSlot &object_slot = page[slot & OBJECTDB_SLOT_PAGE_MASK];
+		if (unlikely((object_slot.data.load(std::memory_order_acquire) & OBJECTDB_VALIDATOR_MASK) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		if (unlikely((object_slot.data.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -1068,4 +1099,25 @@ public:
 	static int get_object_count();
 };
 
+#ifdef DEBUG_ENABLED
+
+// Keeps the object flagged as in use for the duration of a call, so that `free()`
+// can refuse to delete it from within one of its own methods.
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj_id = p_obj->get_instance_id();
+		p_obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		Object *obj_ptr = ObjectDB::get_instance(obj_id);
+		if (likely(obj_ptr)) {
+			obj_ptr->_lock_index.unref();
+		}
+	}
+};
+
+#endif // DEBUG_ENABLED
+
 #endif // OBJECT_H
@@ -33,6 +33,7 @@
 #include "worker_thread_pool.h"
 
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/safe_binary_mutex.h"
 #include "core/os/thread_safe.h"
@@ -89,6 +90,9 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	bool low_priority = p_task->low_priority;
 #endif
 
+	// Graph nodes whose last predecessor was this task.
+	LocalVector<Task *> ready_tasks;
+
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
@@ -120,10 +124,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
+			{
+				MutexLock task_lock(task_mutex);
+				p_task->group->successors_released = true;
+				_release_successors(p_task->group->successors, ready_tasks);
+			}
 			p_task->group->done_semaphore.post();
 			p_task->group->completed.set_to(true);
 		}
-		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
+		uint32_t max_users = p_task->group->tasks_used + (p_task->group->graph_owned ? 0 : 1); // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
 
 		if (finished_users == max_users) {
@@ -159,6 +168,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 				threads[i].signaled = true;
 			}
 		}
+		_release_successors(p_task->successors, ready_tasks);
+		if (p_task->graph_owned) {
+			task_allocator.free(p_task);
+		}
 	}
 
 #ifdef THREADS_ENABLED
@@ -180,14 +193,20 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
 #endif
+
+	if (!ready_tasks.is_empty()) {
+		MutexLock<BinaryMutex> lock(task_mutex);
+		_post_ready_tasks(ready_tasks, lock);
+	}
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Local and stolen tasks don't need the lock; only the shared queue and going to sleep do.
+		Task *task_to_process = thread_data->pool->_pop_or_steal_task(thread_data);
+		if (!task_to_process) {
 			MutexLock lock(thread_data->pool->task_mutex);
 
 			bool exit = thread_data->pool->_handle_runlevel(thread_data, lock);
@@ -200,13 +219,16 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 			if (thread_data->pool->task_queue.first()) {
 				task_to_process = thread_data->pool->task_queue.first()->self();
 				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-			} else {
+			} else if (!thread_data->pool->_has_stealable_tasks()) {
+				// Pushes to local queues happen with the lock held, so this can't miss a wakeup.
 				thread_data->cond_var.wait(lock);
 			}
 		}
 
 		if (task_to_process) {
 			thread_data->pool->_process_task(task_to_process);
+			// Back at the outermost level, so no task can be using temporaries anymore.
+			FrameArena::get_thread_arena().reset();
 		}
 	}
 }
@@ -237,7 +259,11 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			// Tasks posted from a pool thread go to its own queue, where other threads can steal them.
+			// The shared queue is for the rest of threads and as overflow.
+			if (!caller_pool_thread || !caller_pool_thread->local_queue.push(p_tasks[i])) {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -316,6 +342,74 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 	}
 }
 
+void WorkerThreadPool::_release_successors(LocalVector<Task *> &p_successors, LocalVector<Task *> &r_ready) {
+	for (Task *successor : p_successors) {
+		DEV_ASSERT(successor->pending_predecessors > 0);
+		successor->pending_predecessors--;
+		if (successor->pending_predecessors == 0) {
+			r_ready.push_back(successor);
+		}
+	}
+	p_successors.clear();
+}
+
+void WorkerThreadPool::_post_ready_tasks(LocalVector<Task *> &p_ready, MutexLock<BinaryMutex> &p_lock) {
+	// Keep the priority each node was declared with.
+	uint32_t high_priority_count = 0;
+	for (uint32_t i = 0; i < p_ready.size(); i++) {
+		if (!p_ready[i]->low_priority) {
+			SWAP(p_ready[i], p_ready[high_priority_count]);
+			high_priority_count++;
+		}
+	}
+	if (high_priority_count) {
+		_post_tasks(p_ready.ptr(), high_priority_count, true, p_lock);
+	}
+	if (high_priority_count < p_ready.size()) {
+		_post_tasks(p_ready.ptr() + high_priority_count, p_ready.size() - high_priority_count, false, p_lock);
+	}
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_or_steal_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->local_queue.pop(task)) {
+		return task;
+	}
+
+	uint32_t thread_count = threads.size();
+	if (thread_count < 2) {
+		return nullptr;
+	}
+
+	// Start at a random victim so idle threads don't all hammer the same queue.
+	uint32_t seed = p_thread_data->steal_seed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	p_thread_data->steal_seed = seed;
+
+	uint32_t victim_index = seed % thread_count;
+	for (uint32_t i = 0; i < thread_count; i++, victim_index = (victim_index + 1) % thread_count) {
+		ThreadData &victim = threads[victim_index];
+		if (&victim == p_thread_data) {
+			continue;
+		}
+		if (victim.local_queue.steal(task)) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_stealable_tasks() const {
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (!threads[i].local_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
@@ -455,6 +549,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 
 	while (true) {
 		Task *task_to_process = nullptr;
+		bool try_steal = false;
 		bool relock_unlockables = false;
 		{
 			MutexLock lock(task_mutex);
@@ -483,7 +578,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
+					uint32_t to_process = (task_queue.first() || _has_stealable_tasks()) ? 1 : 0;
 					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
@@ -501,12 +596,14 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
+			if (_has_stealable_tasks()) {
+				try_steal = true;
+			} else if (p_caller_pool_thread->pool->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				task_queue.remove(task_queue.first());
 			}
 
-			if (!task_to_process) {
+			if (!task_to_process && !try_steal) {
 				p_caller_pool_thread->awaited_task = p_task;
 
 				if (this == singleton) {
@@ -524,6 +621,19 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 			_lock_unlockable_mutexes();
 		}
 
+		if (try_steal) {
+			task_to_process = _pop_or_steal_task(p_caller_pool_thread);
+			if (!task_to_process) {
+				// Other threads got to the local tasks first. Take shared work, if any, instead of
+				// looping back to the lock while it waits.
+				MutexLock lock(task_mutex);
+				if (task_queue.first()) {
+					task_to_process = task_queue.first()->self();
+					task_queue.remove(task_queue.first());
+				}
+			}
+		}
+
 		if (task_to_process) {
 			_process_task(task_to_process);
 		}
@@ -549,7 +659,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_stealable_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -719,6 +829,239 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 #endif
 }
 
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+	Node node;
+	node.callable = p_callable;
+	node.native_func = p_func;
+	node.native_func_userdata = p_userdata;
+	node.template_userdata = p_template_userdata;
+	node.high_priority = p_high_priority;
+	node.description = p_description;
+	nodes.push_back(node);
+	return nodes.size() - 1;
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+	Node node;
+	node.is_group = true;
+	node.callable = p_callable;
+	node.native_group_func = p_func;
+	node.native_func_userdata = p_userdata;
+	node.template_userdata = p_template_userdata;
+	node.elements = MAX(p_elements, 0);
+	node.tasks = p_tasks;
+	node.high_priority = p_high_priority;
+	node.description = p_description;
+	nodes.push_back(node);
+	return nodes.size() - 1;
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_task(const Callable &p_action, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+}
+
+WorkerThreadPool::TaskGraph::NodeID WorkerThreadPool::TaskGraph::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+}
+
+void WorkerThreadPool::TaskGraph::add_dependency(NodeID p_node, NodeID p_predecessor) {
+	ERR_FAIL_UNSIGNED_INDEX(p_node, nodes.size());
+	ERR_FAIL_COND_MSG(p_predecessor >= p_node, "A task graph node can only depend on nodes added before it.");
+	Edge edge;
+	edge.node = p_node;
+	edge.predecessor = p_predecessor;
+	edges.push_back(edge);
+}
+
+void WorkerThreadPool::TaskGraph::add_task_dependency(NodeID p_node, TaskID p_task) {
+	ERR_FAIL_UNSIGNED_INDEX(p_node, nodes.size());
+	ExternalEdge edge;
+	edge.node = p_node;
+	edge.id = p_task;
+	external_edges.push_back(edge);
+}
+
+void WorkerThreadPool::TaskGraph::add_group_dependency(NodeID p_node, GroupID p_group) {
+	ERR_FAIL_UNSIGNED_INDEX(p_node, nodes.size());
+	ExternalEdge edge;
+	edge.node = p_node;
+	edge.id = p_group;
+	edge.is_group = true;
+	external_edges.push_back(edge);
+}
+
+void WorkerThreadPool::TaskGraph::clear() {
+	for (Node &node : nodes) {
+		if (node.template_userdata) {
+			memdelete(node.template_userdata);
+		}
+	}
+	nodes.clear();
+	edges.clear();
+	external_edges.clear();
+}
+
+WorkerThreadPool::TaskGraph::~TaskGraph() {
+	clear();
+}
+
+static void _task_graph_join(void *p_userdata) {
+	// Nothing to do, it only exists to be waited on.
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::submit_task_graph(TaskGraph &p_graph) {
+	MutexLock<BinaryMutex> lock(task_mutex);
+
+	// Validate first, so nothing has been posted if this fails.
+	for (const TaskGraph::ExternalEdge &E : p_graph.external_edges) {
+		if (E.is_group) {
+			ERR_FAIL_COND_V_MSG(!groups.has(E.id), INVALID_TASK_ID, "Invalid Group ID in task graph dependency.");
+		} else {
+			ERR_FAIL_COND_V_MSG(!tasks.has(E.id), INVALID_TASK_ID, "Invalid Task ID in task graph dependency.");
+		}
+	}
+
+	// The task returned to the caller, which depends on every node.
+	Task *join_task = task_allocator.alloc();
+	TaskID id = last_task++;
+	join_task->self = id;
+	join_task->native_func = _task_graph_join;
+	join_task->description = "TaskGraph";
+	tasks.insert(id, join_task);
+
+	struct NodeInstance {
+		Task *task = nullptr; // Single task node.
+		Group *group = nullptr; // Group node.
+		uint32_t first_task = 0; // Tasks of this node in node_tasks.
+		uint32_t task_count = 0;
+
+		LocalVector<Task *> *get_successors() const { return group ? &group->successors : &task->successors; }
+	};
+	LocalVector<NodeInstance> instances;
+	LocalVector<Task *> node_tasks;
+	instances.resize(p_graph.nodes.size());
+
+	for (uint32_t i = 0; i < p_graph.nodes.size(); i++) {
+		const TaskGraph::Node &node = p_graph.nodes[i];
+		NodeInstance &instance = instances[i];
+		instance.first_task = node_tasks.size();
+
+		if (node.is_group) {
+			if (node.elements == 0) {
+				// Nothing to run, so nothing to wait for either.
+				if (node.template_userdata) {
+					memdelete(node.template_userdata);
+				}
+				continue;
+			}
+			int task_count = node.tasks < 0 ? MAX(1u, threads.size()) : MAX(1, node.tasks);
+
+			Group *group = group_allocator.alloc();
+			group->max = node.elements;
+			group->tasks_used = task_count;
+			group->graph_owned = true;
+			instance.group = group;
+
+			for (int j = 0; j < task_count; j++) {
+				Task *task = task_allocator.alloc();
+				task->native_group_func = node.native_group_func;
+				task->native_func_userdata = node.native_func_userdata;
+				task->description = node.description;
+				task->group = group;
+				task->callable = node.callable;
+				task->template_userdata = node.template_userdata;
+				task->low_priority = !node.high_priority;
+				task->graph_owned = true;
+				node_tasks.push_back(task);
+			}
+		} else {
+			Task *task = task_allocator.alloc();
+			task->callable = node.callable;
+			task->native_func = node.native_func;
+			task->native_func_userdata = node.native_func_userdata;
+			task->description = node.description;
+			task->template_userdata = node.template_userdata;
+			task->low_priority = !node.high_priority;
+			task->graph_owned = true;
+			instance.task = task;
+			node_tasks.push_back(task);
+		}
+		instance.task_count = node_tasks.size() - instance.first_task;
+	}
+
+	for (const TaskGraph::Edge &E : p_graph.edges) {
+		const NodeInstance &predecessor = instances[E.predecessor];
+		const NodeInstance &successor = instances[E.node];
+		if (predecessor.task_count == 0) {
+			continue;
+		}
+		LocalVector<Task *> *successors = predecessor.get_successors();
+		for (uint32_t i = 0; i < successor.task_count; i++) {
+			Task *task = node_tasks[successor.first_task + i];
+			task->pending_predecessors++;
+			successors->push_back(task);
+		}
+	}
+
+	for (const TaskGraph::ExternalEdge &E : p_graph.external_edges) {
+		LocalVector<Task *> *successors = nullptr;
+		if (E.is_group) {
+			Group *group = groups[E.id];
+			if (!group->successors_released) {
+				successors = &group->successors;
+			}
+		} else {
+			Task *task = tasks[E.id];
+			if (!task->completed) {
+				successors = &task->successors;
+			}
+		}
+		if (!successors) {
+			continue; // Already done.
+		}
+		const NodeInstance &successor = instances[E.node];
+		for (uint32_t i = 0; i < successor.task_count; i++) {
+			Task *task = node_tasks[successor.first_task + i];
+			task->pending_predecessors++;
+			successors->push_back(task);
+		}
+	}
+
+	for (const NodeInstance &instance : instances) {
+		if (instance.task_count) {
+			join_task->pending_predecessors++;
+			instance.get_successors()->push_back(join_task);
+		}
+	}
+
+	LocalVector<Task *> ready_tasks;
+	for (Task *task : node_tasks) {
+		if (task->pending_predecessors == 0) {
+			ready_tasks.push_back(task);
+		}
+	}
+	if (join_task->pending_predecessors == 0) {
+		ready_tasks.push_back(join_task);
+	}
+
+	// Ownership of the template userdata has moved to the tasks.
+	p_graph.nodes.clear();
+	p_graph.edges.clear();
+	p_graph.external_edges.clear();
+
+	_post_ready_tasks(ready_tasks, lock);
+
+	return id;
+}
+
 int WorkerThreadPool::get_thread_index() const {
 	Thread::ID tid = Thread::get_caller_id();
 	return thread_ids.has(tid) ? thread_ids[tid] : -1;
@@ -777,6 +1120,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
 		threads[i].pool = this;
+		threads[i].steal_seed = (i + 1) * 2654435761u; // Any non-zero seed works for xorshift.
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
@@ -42,6 +42,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -71,6 +72,9 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		bool graph_owned = false; // Nobody waits on it, so it's freed by its last task.
+		bool successors_released = false;
+		LocalVector<Task *> successors;
 	};
 
 	struct Task {
@@ -90,6 +94,9 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		bool graph_owned = false; // Has no ID, so it's freed as soon as it completes.
+		uint32_t pending_predecessors = 0;
+		LocalVector<Task *> successors;
 
 		void free_template_userdata();
 		Task() :
@@ -109,6 +116,8 @@ private:
 
 	BinaryMutex task_mutex;
 
+	static const uint32_t LOCAL_QUEUE_SIZE = 1024;
+
 	struct ThreadData {
 		static Task *const YIELDING; // Too bad constexpr doesn't work here.
 
@@ -122,6 +131,9 @@ private:
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
+		// Tasks posted by this thread. Popped by it without locking, stolen by the others when idle.
+		WorkStealingDeque<Task *, LOCAL_QUEUE_SIZE> local_queue;
+		uint32_t steal_seed = 0;
 
 		ThreadData() :
 				signaled(false),
@@ -180,6 +192,12 @@ private:
 
 	bool _try_promote_low_priority_task();
 
+	void _release_successors(LocalVector<Task *> &p_successors, LocalVector<Task *> &r_ready);
+	void _post_ready_tasks(LocalVector<Task *> &p_ready, MutexLock<BinaryMutex> &p_lock);
+
+	Task *_pop_or_steal_task(ThreadData *p_thread_data);
+	bool _has_stealable_tasks() const;
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -230,6 +248,87 @@ protected:
 	static void _bind_methods();
 
 public:
+	// A set of tasks and group tasks with dependencies among them, submitted at once with submit_task_graph().
+	// Each node starts as soon as all its predecessors are done, without any thread blocking in between.
+	// Nodes can also depend on tasks and groups already submitted to the pool the usual way.
+	class TaskGraph {
+		friend class WorkerThreadPool;
+
+	public:
+		typedef uint32_t NodeID;
+
+	private:
+		struct Node {
+			Callable callable;
+			void (*native_func)(void *) = nullptr;
+			void (*native_group_func)(void *, uint32_t) = nullptr;
+			void *native_func_userdata = nullptr;
+			BaseTemplateUserdata *template_userdata = nullptr;
+			String description;
+			bool is_group = false;
+			bool high_priority = false;
+			int elements = 0;
+			int tasks = 0;
+		};
+
+		struct Edge {
+			NodeID node = 0;
+			NodeID predecessor = 0;
+		};
+
+		struct ExternalEdge {
+			NodeID node = 0;
+			int64_t id = INVALID_TASK_ID;
+			bool is_group = false;
+		};
+
+		LocalVector<Node> nodes;
+		LocalVector<Edge> edges;
+		LocalVector<ExternalEdge> external_edges;
+
+		NodeID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
+		NodeID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+
+	public:
+		template <typename C, typename M, typename U>
+		NodeID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
+			typedef TaskUserData<C, M, U> TUD;
+			TUD *ud = memnew(TUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description);
+		}
+		NodeID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
+		NodeID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
+
+		template <typename C, typename M, typename U>
+		NodeID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+			typedef GroupUserData<C, M, U> GroupUD;
+			GroupUD *ud = memnew(GroupUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		}
+		NodeID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+		NodeID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+		// Nodes can only depend on nodes added before them, so a graph can't have cycles.
+		void add_dependency(NodeID p_node, NodeID p_predecessor);
+		void add_task_dependency(NodeID p_node, TaskID p_task);
+		void add_group_dependency(NodeID p_node, GroupID p_group);
+
+		uint32_t get_node_count() const { return nodes.size(); }
+		bool is_empty() const { return nodes.is_empty(); }
+		void clear();
+
+		TaskGraph() {}
+		TaskGraph(const TaskGraph &) = delete;
+		TaskGraph &operator=(const TaskGraph &) = delete;
+		~TaskGraph();
+	};
+
 	template <typename C, typename M, typename U>
 	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
 		typedef TaskUserData<C, M, U> TUD;
@@ -263,6 +362,10 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Returns a task that completes once every node in the graph has, to be waited on as usual.
+	// The graph is left empty, so it can be reused to build the next one.
+	TaskID submit_task_graph(TaskGraph &p_graph);
+
 	_FORCE_INLINE_ int get_thread_count() const {
 #ifdef THREADS_ENABLED
 		return threads.size();
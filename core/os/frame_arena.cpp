@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+thread_local FrameArena FrameArena::thread_arena;
+
+void FrameArena::_next_chunk(size_t p_block_size) {
+	// Reuse the chunks left from previous frames first.
+	while (chunk_count && current_chunk + 1 < chunk_count) {
+		current_chunk++;
+		offset = 0;
+		if (chunks[current_chunk].size >= p_block_size) {
+			return;
+		}
+	}
+
+	Chunk chunk;
+	chunk.size = MAX(p_block_size, DEFAULT_CHUNK_SIZE);
+	chunk.memory = (uint8_t *)memalloc(chunk.size);
+	CRASH_COND_MSG(!chunk.memory, "Out of memory");
+
+	chunks = (Chunk *)memrealloc(chunks, sizeof(Chunk) * (chunk_count + 1));
+	CRASH_COND_MSG(!chunks, "Out of memory");
+	chunks[chunk_count] = chunk;
+	current_chunk = chunk_count;
+	chunk_count++;
+	offset = 0;
+}
+
+void *FrameArena::alloc(size_t p_bytes) {
+	size_t block_size = _get_block_size(p_bytes);
+	if (unlikely(chunk_count == 0 || offset + block_size > chunks[current_chunk].size)) {
+		_next_chunk(block_size);
+	}
+
+	uint8_t *block = chunks[current_chunk].memory + offset;
+	offset += block_size;
+	used += block_size;
+	peak_used = MAX(peak_used, used);
+
+	Header *header = (Header *)block;
+	header->size = p_bytes;
+	header->generation = generation;
+
+	last_alloc = block + sizeof(Header);
+	return last_alloc;
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_bytes) {
+	if (!p_memory) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_memory);
+		return nullptr;
+	}
+
+	Header *header = _get_header(p_memory);
+	DEV_ASSERT(!owns(p_memory) || header->generation == generation);
+
+	if (p_memory == last_alloc) {
+		// Grow or shrink in place if it's still the latest allocation.
+		size_t old_block_size = _get_block_size(header->size);
+		size_t new_block_size = _get_block_size(p_bytes);
+		if (offset - old_block_size + new_block_size <= chunks[current_chunk].size) {
+			offset = offset - old_block_size + new_block_size;
+			used = used - old_block_size + new_block_size;
+			peak_used = MAX(peak_used, used);
+			header->size = p_bytes;
+			return p_memory;
+		}
+	}
+
+	void *new_memory = alloc(p_bytes);
+	memcpy(new_memory, p_memory, MIN(header->size, p_bytes));
+	// Not the latest allocation anymore, so this only drops it.
+	free(p_memory);
+	return new_memory;
+}
+
+void FrameArena::free(void *p_memory) {
+	if (!p_memory || p_memory != last_alloc) {
+		// Released in bulk by reset(). This also covers memory from other threads' arenas.
+		return;
+	}
+
+	Header *header = _get_header(p_memory);
+	DEV_ASSERT(header->generation == generation);
+	size_t block_size = _get_block_size(header->size);
+	offset -= block_size;
+	used -= block_size;
+	last_alloc = nullptr;
+}
+
+bool FrameArena::owns(const void *p_memory) const {
+	const uint8_t *memory = (const uint8_t *)p_memory;
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		if (memory >= chunks[i].memory && memory < chunks[i].memory + chunks[i].size) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void FrameArena::reset() {
+	if (chunk_count > 1) {
+		// The frame didn't fit in one chunk; use a single one big enough for all of it from now on.
+		size_t total_size = get_capacity();
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			memfree(chunks[i].memory);
+		}
+		chunks[0].size = total_size;
+		chunks[0].memory = (uint8_t *)memalloc(total_size);
+		CRASH_COND_MSG(!chunks[0].memory, "Out of memory");
+		chunk_count = 1;
+	}
+
+	current_chunk = 0;
+	offset = 0;
+	used = 0;
+	last_alloc = nullptr;
+	generation++;
+}
+
+size_t FrameArena::get_capacity() const {
+	size_t capacity = 0;
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		capacity += chunks[i].size;
+	}
+	return capacity;
+}
+
+FrameArena::~FrameArena() {
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		memfree(chunks[i].memory);
+	}
+	if (chunks) {
+		memfree(chunks);
+	}
+}
@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+// Per-thread bump allocator for short-lived allocations.
+// Allocating is a pointer bump and freeing is a no-op (except for the latest allocation,
+// which is rolled back), so temporaries cost almost nothing compared to the global allocator.
+// Everything is released at once by reset():
+// - The main thread's arena is reset at the start of every iteration of the main loop.
+// - WorkerThreadPool threads reset theirs after each task they pick from the queues.
+// - Any other code can rewind to a point with FrameArena::Scope.
+// Memory from a thread's arena must not outlive the frame (or task) nor be handed to other threads.
+class FrameArena {
+	static constexpr size_t ALIGNMENT = alignof(max_align_t);
+	static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+	struct Header {
+		uint64_t size = 0;
+		uint64_t generation = 0; // To catch use of memory from before the last reset.
+	};
+	static_assert(sizeof(Header) % ALIGNMENT == 0);
+
+	struct Chunk {
+		uint8_t *memory = nullptr;
+		size_t size = 0;
+	};
+
+	Chunk *chunks = nullptr;
+	uint32_t chunk_count = 0;
+	uint32_t current_chunk = 0;
+	size_t offset = 0;
+	uint8_t *last_alloc = nullptr;
+	uint64_t generation = 1;
+	size_t used = 0;
+	size_t peak_used = 0;
+
+	static thread_local FrameArena thread_arena;
+
+	static _FORCE_INLINE_ size_t _get_block_size(size_t p_bytes) {
+		return sizeof(Header) + ((p_bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+	}
+	_FORCE_INLINE_ Header *_get_header(void *p_memory) const {
+		return (Header *)((uint8_t *)p_memory - sizeof(Header));
+	}
+
+	void _next_chunk(size_t p_block_size);
+
+public:
+	struct Scope {
+		FrameArena &arena;
+		uint32_t chunk;
+		size_t offset;
+		size_t used;
+
+		// Allocations made after the scope starts are released when it ends.
+		Scope(FrameArena &p_arena = FrameArena::get_thread_arena()) :
+				arena(p_arena), chunk(p_arena.current_chunk), offset(p_arena.offset), used(p_arena.used) {}
+		~Scope() {
+			arena.current_chunk = chunk;
+			arena.offset = offset;
+			arena.used = used;
+			arena.last_alloc = nullptr;
+		}
+	};
+
+	void *alloc(size_t p_bytes);
+	void *realloc(void *p_memory, size_t p_bytes);
+	void free(void *p_memory);
+	bool owns(const void *p_memory) const;
+
+	// Releases every allocation at once. Chunks are kept (and merged) for the next frame.
+	void reset();
+
+	size_t get_used_bytes() const { return used; }
+	size_t get_peak_used_bytes() const { return peak_used; }
+	size_t get_capacity() const;
+
+	_FORCE_INLINE_ static FrameArena &get_thread_arena() { return thread_arena; }
+
+	FrameArena() {}
+	FrameArena(const FrameArena &) = delete;
+	FrameArena &operator=(const FrameArena &) = delete;
+	~FrameArena();
+};
+
+// Allocator using the calling thread's FrameArena, for the containers that take one.
+class FrameArenaAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return FrameArena::get_thread_arena().alloc(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_memory, size_t p_bytes) { return FrameArena::get_thread_arena().realloc(p_memory, p_bytes); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { FrameArena::get_thread_arena().free(p_ptr); }
+};
+
+// LocalVector for per-frame temporaries. It must not be kept past the frame.
+template <typename T, typename U = uint32_t, bool force_trivial = false>
+using FrameLocalVector = LocalVector<T, U, force_trivial, false, FrameArenaAllocator>;
+
+#endif // FRAME_ARENA_H
@@ -32,14 +32,20 @@
 
 #include "memory.h"
 
+#include "core/os/spin_lock.h"
 #include "core/templates/safe_refcount.h"
 
 #include <stdlib.h>
 #include <string.h>
 
-void *operator new(size_t p_size, const char *p_description) {
-	return Memory::alloc_static(p_size, false);
-}
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CALLER_ADDRESS _ReturnAddress()
+#elif defined(__GNUC__) || defined(__clang__)
+#define CALLER_ADDRESS __builtin_return_address(0)
+#else
+#define CALLER_ADDRESS nullptr
+#endif
 
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)) {
 	return p_allocfunc(p_size);
@@ -66,6 +72,150 @@ SafeNumeric<uint64_t> Memory::max_usage;
 
 SafeNumeric<uint64_t> Memory::alloc_count;
 
+SafeFlag Memory::allocation_tracking;
+uint32_t Memory::allocation_sample_interval = 1024;
+SafeNumeric<uint64_t> Memory::tracked_count[ALLOCATION_TAG_MAX];
+SafeNumeric<uint64_t> Memory::tracked_bytes[ALLOCATION_TAG_MAX];
+Memory::AllocationStats Memory::frame_start_stats[ALLOCATION_TAG_MAX];
+Memory::AllocationStats Memory::last_frame_stats[ALLOCATION_TAG_MAX];
+thread_local Memory::AllocationTag Memory::current_tag = Memory::ALLOCATION_TAG_UNTAGGED;
+thread_local uint32_t Memory::sample_countdown = 0;
+
+// Sampled allocation sites, in a fixed-size open-addressing table so recording never allocates.
+static const uint32_t ALLOCATION_SITES_SIZE = 4096;
+static const uint32_t ALLOCATION_SITES_MAX_PROBES = 16;
+static Memory::AllocationSite allocation_sites[ALLOCATION_SITES_SIZE];
+static SpinLock allocation_sites_lock;
+
+void Memory::_track_allocation(size_t p_bytes, void *p_site) {
+	AllocationTag tag = current_tag;
+	tracked_count[tag].increment();
+	tracked_bytes[tag].add(p_bytes);
+
+	// The countdown is per thread, so it may be left over from a larger interval.
+	if (sample_countdown > 0 && sample_countdown < allocation_sample_interval) {
+		sample_countdown--;
+		return;
+	}
+	sample_countdown = allocation_sample_interval - 1;
+
+	uint32_t hash = uint32_t(((uintptr_t)p_site >> 2) * 2654435761u);
+	// If no slot is found within a few probes, the table is too crowded and the sample is dropped.
+	allocation_sites_lock.lock();
+	for (uint32_t i = 0; i < ALLOCATION_SITES_MAX_PROBES; i++) {
+		AllocationSite &site = allocation_sites[(hash + i) & (ALLOCATION_SITES_SIZE - 1)];
+		if (site.address == p_site && site.tag == tag) {
+			site.samples++;
+			site.bytes += p_bytes;
+			break;
+		} else if (site.address == nullptr) {
+			site.address = p_site;
+			site.tag = tag;
+			site.samples = 1;
+			site.bytes = p_bytes;
+			break;
+		}
+	}
+	allocation_sites_lock.unlock();
+}
+
+void Memory::set_allocation_tracking_enabled(bool p_enabled, uint32_t p_sample_interval) {
+	allocation_sample_interval = MAX(p_sample_interval, 1u);
+	allocation_tracking.set_to(p_enabled);
+}
+
+void Memory::reset_allocation_tracking() {
+	allocation_sites_lock.lock();
+	for (uint32_t i = 0; i < ALLOCATION_SITES_SIZE; i++) {
+		allocation_sites[i] = AllocationSite();
+	}
+	allocation_sites_lock.unlock();
+
+	for (int i = 0; i < ALLOCATION_TAG_MAX; i++) {
+		tracked_count[i].set(0);
+		tracked_bytes[i].set(0);
+		frame_start_stats[i] = AllocationStats();
+		last_frame_stats[i] = AllocationStats();
+	}
+}
+
+void Memory::end_allocation_frame() {
+	if (!is_allocation_tracking_enabled()) {
+		return;
+	}
+	for (int i = 0; i < ALLOCATION_TAG_MAX; i++) {
+		AllocationStats now;
+		now.count = tracked_count[i].get();
+		now.bytes = tracked_bytes[i].get();
+		last_frame_stats[i].count = now.count - frame_start_stats[i].count;
+		last_frame_stats[i].bytes = now.bytes - frame_start_stats[i].bytes;
+		frame_start_stats[i] = now;
+	}
+}
+
+Memory::AllocationStats Memory::get_frame_allocation_stats(AllocationTag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, ALLOCATION_TAG_MAX + 1, AllocationStats());
+	if (p_tag != ALLOCATION_TAG_MAX) {
+		return last_frame_stats[p_tag];
+	}
+	AllocationStats stats;
+	for (int i = 0; i < ALLOCATION_TAG_MAX; i++) {
+		stats.count += last_frame_stats[i].count;
+		stats.bytes += last_frame_stats[i].bytes;
+	}
+	return stats;
+}
+
+Memory::AllocationStats Memory::get_total_allocation_stats(AllocationTag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, ALLOCATION_TAG_MAX + 1, AllocationStats());
+	AllocationStats stats;
+	for (int i = 0; i < ALLOCATION_TAG_MAX; i++) {
+		if (p_tag == ALLOCATION_TAG_MAX || p_tag == i) {
+			stats.count += tracked_count[i].get();
+			stats.bytes += tracked_bytes[i].get();
+		}
+	}
+	return stats;
+}
+
+uint32_t Memory::get_allocation_sites(AllocationSite *r_sites, uint32_t p_max) {
+	uint32_t count = 0;
+	allocation_sites_lock.lock();
+	for (uint32_t i = 0; i < ALLOCATION_SITES_SIZE; i++) {
+		const AllocationSite &site = allocation_sites[i];
+		if (site.address == nullptr) {
+			continue;
+		}
+		// Insertion sort into the output, keeping only the most sampled.
+		uint32_t pos = count;
+		while (pos > 0 && r_sites[pos - 1].samples < site.samples) {
+			if (pos < p_max) {
+				r_sites[pos] = r_sites[pos - 1];
+			}
+			pos--;
+		}
+		if (pos < p_max) {
+			r_sites[pos] = site;
+			count = MIN(count + 1, p_max);
+		}
+	}
+	allocation_sites_lock.unlock();
+	return count;
+}
+
+const char *Memory::get_allocation_tag_name(AllocationTag p_tag) {
+	static const char *names[ALLOCATION_TAG_MAX] = {
+		"untagged",
+		"variant",
+		"string_name",
+		"resource",
+		"physics",
+		"rendering",
+	};
+	ERR_FAIL_INDEX_V(p_tag, ALLOCATION_TAG_MAX, "");
+	return names[p_tag];
+}
+
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
 	DEV_ASSERT(is_power_of_2(p_alignment));
 
@@ -111,6 +261,10 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	alloc_count.increment();
 
+	if (unlikely(allocation_tracking.is_set())) {
+		_track_allocation(p_bytes, CALLER_ADDRESS);
+	}
+
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
 
@@ -140,6 +294,11 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
+	if (unlikely(allocation_tracking.is_set()) && p_bytes > 0) {
+		// Growing containers churn the allocator as much as new allocations do.
+		_track_allocation(p_bytes, CALLER_ADDRESS);
+	}
+
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
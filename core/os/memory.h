@@ -41,6 +41,35 @@
 #include <type_traits>
 
 class Memory {
+public:
+	// Subsystems allocations are attributed to when tracking is enabled (see MemoryTagScope).
+	enum AllocationTag {
+		ALLOCATION_TAG_UNTAGGED,
+		ALLOCATION_TAG_VARIANT,
+		ALLOCATION_TAG_STRING_NAME,
+		ALLOCATION_TAG_RESOURCE,
+		ALLOCATION_TAG_PHYSICS,
+		ALLOCATION_TAG_RENDERING,
+		ALLOCATION_TAG_MAX
+	};
+
+	// Sites are the return address into the immediate caller of the allocator, to be resolved with the debug symbols.
+	// For memnew and memalloc that is the line using them. Containers (CowData, LocalVector, HashMap...) call the
+	// allocator themselves, so their allocations resolve to the innermost container function that was not inlined;
+	// tags are what attributes those to a subsystem.
+	struct AllocationSite {
+		void *address = nullptr;
+		AllocationTag tag = ALLOCATION_TAG_UNTAGGED;
+		uint64_t samples = 0;
+		uint64_t bytes = 0;
+	};
+
+	struct AllocationStats {
+		uint64_t count = 0;
+		uint64_t bytes = 0;
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
@@ -48,6 +77,20 @@ class Memory {
 
 	static SafeNumeric<uint64_t> alloc_count;
 
+	// Allocation tracking. Off by default; when off it costs a single flag check per allocation.
+	static SafeFlag allocation_tracking;
+	static uint32_t allocation_sample_interval;
+	static SafeNumeric<uint64_t> tracked_count[ALLOCATION_TAG_MAX];
+	static SafeNumeric<uint64_t> tracked_bytes[ALLOCATION_TAG_MAX];
+	static AllocationStats frame_start_stats[ALLOCATION_TAG_MAX];
+	static AllocationStats last_frame_stats[ALLOCATION_TAG_MAX];
+	static thread_local AllocationTag current_tag;
+	static thread_local uint32_t sample_countdown;
+
+	friend class MemoryTagScope;
+
+	static void _track_allocation(size_t p_bytes, void *p_site);
+
 public:
 	// Alignment:  ↓ max_align_t        ↓ uint64_t          ↓ max_align_t
 	//             ┌─────────────────┬──┬────────────────┬──┬───────────...
@@ -91,15 +134,53 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	// Counts allocations per tag and samples one every `p_sample_interval` allocations to find the sites churning the allocator.
+	static void set_allocation_tracking_enabled(bool p_enabled, uint32_t p_sample_interval = 1024);
+	_FORCE_INLINE_ static bool is_allocation_tracking_enabled() { return allocation_tracking.is_set(); }
+	static void reset_allocation_tracking();
+
+	// Called by the main loop once per frame, so per-frame stats refer to the last complete frame.
+	static void end_allocation_frame();
+	static AllocationStats get_frame_allocation_stats(AllocationTag p_tag = ALLOCATION_TAG_MAX); // ALLOCATION_TAG_MAX means all tags.
+	static AllocationStats get_total_allocation_stats(AllocationTag p_tag = ALLOCATION_TAG_MAX);
+	// Fills up to `p_max` sites, the most sampled first. Returns how many were filled.
+	static uint32_t get_allocation_sites(AllocationSite *r_sites, uint32_t p_max);
+	static const char *get_allocation_tag_name(AllocationTag p_tag);
+};
+
+// Attributes the allocations made by the current thread within the scope to a tag, if tracking is enabled.
+class MemoryTagScope {
+	Memory::AllocationTag previous_tag = Memory::ALLOCATION_TAG_UNTAGGED;
+	bool active = false;
+
+public:
+	_FORCE_INLINE_ explicit MemoryTagScope(Memory::AllocationTag p_tag) {
+		if (unlikely(Memory::is_allocation_tracking_enabled())) {
+			previous_tag = Memory::current_tag;
+			Memory::current_tag = p_tag;
+			active = true;
+		}
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		if (unlikely(active)) {
+			Memory::current_tag = previous_tag;
+		}
+	}
 };
 
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_memory, size_t p_bytes) { return Memory::realloc_static(p_memory, p_bytes, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
-void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
+// operator new that takes a description and uses MemoryStaticPool.
+// Inline, so allocation tracking sees the site of each memnew rather than this function.
+_ALWAYS_INLINE_ void *operator new(size_t p_size, const char *p_description) {
+	return Memory::alloc_static(p_size, false);
+}
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
 void *operator new(size_t p_size, void *p_pointer, size_t check, const char *p_description); ///< operator new that takes a description and uses a pointer to the preallocated memory
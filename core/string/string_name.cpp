@@ -33,8 +33,23 @@
 #include "string_name.h"
 
 #include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 
+// The bucket table is guarded by striped locks, picked from the low bits of the bucket
+// index, so threads interning different names rarely wait on each other.
+static constexpr uint32_t STRING_NAME_LOCK_COUNT = 64;
+
+struct alignas(Thread::CACHE_LINE_BYTES) StringNameTableLock {
+	BinaryMutex mutex;
+};
+
+static StringNameTableLock string_name_table_locks[STRING_NAME_LOCK_COUNT];
+
+static _FORCE_INLINE_ BinaryMutex &_get_table_lock(uint32_t p_idx) {
+	return string_name_table_locks[p_idx & (STRING_NAME_LOCK_COUNT - 1)].mutex;
+}
+
 StaticCString StaticCString::create(const char *p_ptr) {
 	StaticCString scs;
 	scs.ptr = p_ptr;
@@ -78,8 +93,6 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(mutex);
-
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
@@ -111,6 +124,7 @@ void StringName::cleanup() {
 #endif
 	int lost_strings = 0;
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
+		MutexLock lock(_get_table_lock(i));
 		while (_table[i]) {
 			_Data *d = _table[i];
 			if (d->static_count.get() != d->refcount.get()) {
@@ -137,7 +151,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		MutexLock lock(_get_table_lock(_data->idx));
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -274,7 +288,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 	const uint32_t hash = String::hash(p_name);
 	const uint32_t idx = hash & STRING_TABLE_MASK;
 
-	MutexLock lock(mutex);
+	MutexLock lock(_get_table_lock(idx));
 	_data = _table[idx];
 
 	while (_data) {
@@ -298,6 +312,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_STRING_NAME);
 	_data = memnew(_Data);
 	_data->name = p_name;
 	_data->refcount.init();
@@ -331,7 +346,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 	const uint32_t hash = String::hash(p_static_string.ptr);
 	const uint32_t idx = hash & STRING_TABLE_MASK;
 
-	MutexLock lock(mutex);
+	MutexLock lock(_get_table_lock(idx));
 	_data = _table[idx];
 
 	while (_data) {
@@ -355,6 +370,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_STRING_NAME);
 	_data = memnew(_Data);
 
 	_data->refcount.init();
@@ -389,7 +405,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 	const uint32_t hash = p_name.hash();
 	const uint32_t idx = hash & STRING_TABLE_MASK;
 
-	MutexLock lock(mutex);
+	MutexLock lock(_get_table_lock(idx));
 	_data = _table[idx];
 
 	while (_data) {
@@ -412,6 +428,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_STRING_NAME);
 	_data = memnew(_Data);
 	_data->name = p_name;
 	_data->refcount.init();
@@ -446,7 +463,7 @@ StringName StringName::search(const char *p_name) {
 	const uint32_t hash = String::hash(p_name);
 	const uint32_t idx = hash & STRING_TABLE_MASK;
 
-	MutexLock lock(mutex);
+	MutexLock lock(_get_table_lock(idx));
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -481,7 +498,7 @@ StringName StringName::search(const char32_t *p_name) {
 	const uint32_t hash = String::hash(p_name);
 	const uint32_t idx = hash & STRING_TABLE_MASK;
 
-	MutexLock lock(mutex);
+	MutexLock lock(_get_table_lock(idx));
 	_Data *_data = _table[idx];
 
 	while (_data) {
@@ -505,7 +522,7 @@ StringName StringName::search(const String &p_name) {
 	const uint32_t hash = p_name.hash();
 	const uint32_t idx = hash & STRING_TABLE_MASK;
 
-	MutexLock lock(mutex);
+	MutexLock lock(_get_table_lock(idx));
 	_Data *_data = _table[idx];
 
 	while (_data) {
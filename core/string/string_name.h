@@ -82,7 +82,7 @@ class StringName {
 	friend void register_core_types();
 	friend void unregister_core_types();
 	friend class Main;
-	static inline Mutex mutex;
+	static inline Mutex mutex; // Only for assign_static_unique_class_name(), table buckets use striped locks.
 	static void setup();
 	static void cleanup();
 	static uint32_t get_empty_hash();
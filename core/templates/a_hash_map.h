@@ -33,6 +33,7 @@
 #ifndef A_HASH_MAP_H
 #define A_HASH_MAP_H
 
+#include "core/templates/hash_group.h"
 #include "core/templates/hash_map.h"
 
 struct HashMapData {
@@ -166,6 +167,61 @@ private:
 
 			pos = (pos + 1) & capacity;
 			distance++;
+
+			if (unlikely(distance == HashGroup::WIDTH)) {
+				return _lookup_pos_in_groups(p_key, r_pos, r_hash_pos, p_hash, pos, distance);
+			}
+		}
+	}
+
+	// Continues a long probe sequence, comparing a group of slots at a time.
+	// Most lookups end within the first few slots, where probing one slot at a time is cheaper.
+	bool _lookup_pos_in_groups(const TKey &p_key, uint32_t &r_pos, uint32_t &r_hash_pos, uint32_t p_hash, uint32_t p_pos, uint32_t p_distance) const {
+		uint32_t pos = p_pos;
+		uint32_t distance = p_distance;
+		while (true) {
+			if (likely(pos + HashGroup::WIDTH <= capacity + 1)) {
+				uint32_t empty;
+				uint32_t match = HashGroup::match_interleaved(&map_data[pos].hash, p_hash, empty);
+				match &= HashGroup::before_first_empty(empty);
+				for (uint32_t i = 0; match != 0; i++, match >>= 1) {
+					if ((match & 1) && Comparator::compare(elements[map_data[pos + i].hash_to_key].key, p_key)) {
+						r_pos = map_data[pos + i].hash_to_key;
+						r_hash_pos = pos + i;
+						return true;
+					}
+				}
+
+				if (empty != 0) {
+					return false;
+				}
+
+				// Only the last slot of the group needs checking against the probe length.
+				pos += HashGroup::WIDTH - 1;
+				distance += HashGroup::WIDTH - 1;
+				if (distance > _get_probe_length(pos, map_data[pos].hash, capacity)) {
+					return false;
+				}
+			} else {
+				// The group would wrap around, probe a single slot.
+				HashMapData data = map_data[pos];
+				if (data.hash == p_hash && Comparator::compare(elements[data.hash_to_key].key, p_key)) {
+					r_pos = data.hash_to_key;
+					r_hash_pos = pos;
+					return true;
+				}
+
+				if (data.data == EMPTY_HASH) {
+					return false;
+				}
+
+				if (distance > _get_probe_length(pos, data.hash, capacity)) {
+					return false;
+				}
+			}
+
+			pos = (pos + 1) & capacity;
+			distance++;
 		}
 	}
 
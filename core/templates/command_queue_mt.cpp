@@ -32,9 +32,271 @@
 
 #include "command_queue_mt.h"
 
+#include "core/os/os.h"
+
+thread_local CommandQueueMT::ProducerCache CommandQueueMT::producer_cache;
+std::atomic<uint64_t> CommandQueueMT::last_queue_id = { 0 };
+SpinLock CommandQueueMT::live_queues_lock;
+LocalVector<CommandQueueMT *> CommandQueueMT::live_queues;
+
+CommandQueueMT::ProducerCache::~ProducerCache() {
+	for (uint32_t i = 0; i < SIZE; i++) {
+		if (entries[i].producer) {
+			_retire_producer(entries[i].queue_id, entries[i].producer);
+		}
+	}
+}
+
+CommandQueueMT::Block *CommandQueueMT::_alloc_block(uint32_t p_min_capacity) {
+	const uint32_t default_capacity = DEFAULT_COMMAND_MEM_SIZE_KB * 1024;
+	Block *block = nullptr;
+	if (p_min_capacity <= default_capacity) {
+		free_blocks_lock.lock();
+		if (free_blocks.size()) {
+			block = free_blocks[free_blocks.size() - 1];
+			free_blocks.resize(free_blocks.size() - 1);
+		}
+		free_blocks_lock.unlock();
+	}
+
+	if (block) {
+		block->committed.store(0, std::memory_order_relaxed);
+		block->next.store(nullptr, std::memory_order_relaxed);
+		block->write_pos = 0;
+		block->read_pos = 0;
+	} else {
+		const uint32_t capacity = MAX(p_min_capacity, default_capacity);
+		block = memnew_placement(Memory::alloc_static(sizeof(Block) + capacity), Block);
+		block->capacity = capacity;
+	}
+	return block;
+}
+
+void CommandQueueMT::_free_block(Block *p_block) {
+	if (p_block->capacity == DEFAULT_COMMAND_MEM_SIZE_KB * 1024) {
+		free_blocks_lock.lock();
+		free_blocks.push_back(p_block);
+		free_blocks_lock.unlock();
+	} else {
+		p_block->~Block();
+		Memory::free_static(p_block);
+	}
+}
+
+CommandQueueMT::Block *CommandQueueMT::_next_block(Producer *p_producer, uint32_t p_min_capacity) {
+	Block *block = _alloc_block(p_min_capacity);
+	// The producer never touches the previous block again, the consumer can recycle it once read.
+	p_producer->write_block->next.store(block, std::memory_order_release);
+	p_producer->write_block = block;
+	return block;
+}
+
+CommandQueueMT::Producer *CommandQueueMT::_register_producer() {
+	Producer *producer = memnew(Producer);
+	producer->write_block = _alloc_block(0);
+	producer->read_block = producer->write_block;
+	producer->next = producers.load(std::memory_order_relaxed);
+	while (!producers.compare_exchange_weak(producer->next, producer, std::memory_order_release, std::memory_order_relaxed)) {
+	}
+
+	ProducerCache::Entry &entry = producer_cache.entries[producer_cache.next_slot];
+	producer_cache.next_slot = (producer_cache.next_slot + 1) % ProducerCache::SIZE;
+	if (entry.producer) {
+		_retire_producer(entry.queue_id, entry.producer);
+	}
+	entry.queue_id = queue_id;
+	entry.producer = producer;
+	return producer;
+}
+
+void CommandQueueMT::_retire_producer(uint64_t p_queue_id, Producer *p_producer) {
+	// The lock keeps the queue from being destroyed meanwhile. Once retired, the producer
+	// may be freed by the consumer at any time, so it is not touched afterwards.
+	live_queues_lock.lock();
+	for (CommandQueueMT *queue : live_queues) {
+		if (queue->queue_id == p_queue_id) {
+			queue->retired_producers.fetch_add(1, std::memory_order_relaxed);
+			p_producer->retired.store(true, std::memory_order_release);
+			break;
+		}
+	}
+	live_queues_lock.unlock();
+}
+
+void CommandQueueMT::_free_retired_producers() {
+	// Only the consumer unlinks producers. Threads only ever push new producers at the head,
+	// so links past the head are the consumer's alone; the head itself needs a CAS.
+	Producer *prev = nullptr;
+	Producer *producer = producers.load(std::memory_order_acquire);
+	while (producer) {
+		Producer *next = producer->next;
+		// Retired is stored after the producer's last commit, so nothing unread means nothing more to read.
+		if (!producer->retired.load(std::memory_order_acquire) || _peek_command(producer)) {
+			prev = producer;
+			producer = next;
+			continue;
+		}
+
+		if (prev) {
+			prev->next = next;
+		} else {
+			Producer *head = producer;
+			if (!producers.compare_exchange_strong(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+				// New producers were pushed in front of it meanwhile.
+				prev = head;
+				while (prev->next != producer) {
+					prev = prev->next;
+				}
+				prev->next = next;
+			}
+		}
+
+		if (read_producer == producer) {
+			read_producer = nullptr;
+		}
+		// All blocks but the last were freed while reading.
+		_free_block(producer->read_block);
+		memdelete(producer);
+		retired_producers.fetch_sub(1, std::memory_order_relaxed);
+		producer = next;
+	}
+}
+
+uint32_t CommandQueueMT::get_producer_count() {
+	MutexLock lock(flush_mutex);
+	uint32_t count = 0;
+	for (Producer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+		count++;
+	}
+	return count;
+}
+
+CommandQueueMT::CommandHeader *CommandQueueMT::_peek_command(Producer *p_producer) {
+	Block *block = p_producer->read_block;
+	while (true) {
+		// Load next before committed: once next is set, committed is final.
+		Block *next = block->next.load(std::memory_order_acquire);
+		if (block->read_pos < block->committed.load(std::memory_order_acquire)) {
+			return reinterpret_cast<CommandHeader *>(block->get_data() + block->read_pos);
+		}
+		if (!next) {
+			return nullptr;
+		}
+		p_producer->read_block = next;
+		_free_block(block);
+		block = next;
+	}
+}
+
+CommandQueueMT::CommandHeader *CommandQueueMT::_wait_for_command(uint64_t p_ticket) {
+	// Most of the time the same producer pushes many commands in a row.
+	if (read_producer) {
+		CommandHeader *header = _peek_command(read_producer);
+		if (header && header->ticket == p_ticket) {
+			return header;
+		}
+	}
+
+	uint32_t spins = 0;
+	while (true) {
+		for (Producer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+			CommandHeader *header = _peek_command(producer);
+			if (header && header->ticket == p_ticket) {
+				read_producer = producer;
+				return header;
+			}
+		}
+		// The ticket was taken, but the producer is still writing the command.
+		if (++spins < 64) {
+			_cpu_pause();
+		} else {
+			OS::get_singleton()->delay_usec(1);
+		}
+	}
+}
+
+void CommandQueueMT::_notify_pump() {
+	const WorkerThreadPool::TaskID pump = pump_task_id.load(std::memory_order_acquire);
+	if (pump != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->notify_yield_over(pump);
+	}
+}
+
+void CommandQueueMT::_flush() {
+	if (unlikely(flushing.load(std::memory_order_acquire))) {
+		// Re-entrant call.
+		return;
+	}
+
+	MutexLock lock(flush_mutex);
+	flushing.store(true, std::memory_order_release);
+
+	while (true) {
+		while (read_ticket < next_ticket.load(std::memory_order_acquire)) {
+			CommandHeader *header = _wait_for_command(read_ticket);
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(header + 1);
+
+			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(lock);
+			cmd->call();
+			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
+
+			if (unlikely(cmd->sync)) {
+				synced_ticket.store(read_ticket + 1, std::memory_order_release);
+				// Lock so the notification can't fall between an awaiter's check and its wait.
+				mutex.lock();
+				mutex.unlock();
+				sync_cond_var.notify_all();
+			}
+
+			cmd->~CommandBase();
+
+			read_producer->read_block->read_pos += sizeof(CommandHeader) + header->size;
+			read_ticket++;
+		}
+
+		pending.store(false, std::memory_order_release);
+		// Something may have been pushed between the last check and clearing the flag.
+		if (read_ticket == next_ticket.load(std::memory_order_acquire)) {
+			break;
+		}
+	}
+
+	if (retired_producers.load(std::memory_order_relaxed) > 0) {
+		_free_retired_producers();
+	}
+
+	flushing.store(false, std::memory_order_release);
+}
+
 CommandQueueMT::CommandQueueMT() {
-	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
+	queue_id = ++last_queue_id;
+
+	live_queues_lock.lock();
+	live_queues.push_back(this);
+	live_queues_lock.unlock();
 }
 
 CommandQueueMT::~CommandQueueMT() {
+	live_queues_lock.lock();
+	live_queues.erase(this);
+	live_queues_lock.unlock();
+
+	Producer *producer = producers.load(std::memory_order_acquire);
+	while (producer) {
+		Block *block = producer->read_block;
+		while (block) {
+			Block *next = block->next.load(std::memory_order_relaxed);
+			block->~Block();
+			Memory::free_static(block);
+			block = next;
+		}
+		Producer *next = producer->next;
+		memdelete(producer);
+		producer = next;
+	}
+
+	for (Block *block : free_blocks) {
+		block->~Block();
+		Memory::free_static(block);
+	}
 }
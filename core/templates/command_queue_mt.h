@@ -36,6 +36,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/condition_variable.h"
 #include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
 #include "core/templates/tuple.h"
@@ -108,102 +109,138 @@ class CommandQueueMT {
 
 	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
 
+	// Producers never lock: each producer thread writes commands into its own chain of blocks,
+	// publishing them to the consumer with a release store. Every command takes a ticket from a
+	// shared counter, so the consumer still runs them in the order they were pushed across threads
+	// (e.g. an RID initialized by one thread and then used by another).
+
+	struct CommandHeader {
+		uint64_t ticket = 0;
+		uint64_t size = 0; // Size of the command that follows.
+	};
+
+	struct Block {
+		std::atomic<uint32_t> committed = { 0 }; // Bytes the consumer can read.
+		std::atomic<Block *> next = { nullptr }; // Set by the producer once it moves on to a new block.
+		uint32_t capacity = 0;
+		uint32_t write_pos = 0; // Producer side.
+		uint32_t read_pos = 0; // Consumer side.
+
+		_FORCE_INLINE_ uint8_t *get_data() { return reinterpret_cast<uint8_t *>(this + 1); }
+	};
+
+	struct Producer {
+		Block *write_block = nullptr; // Producer side.
+		Block *read_block = nullptr; // Consumer side.
+		std::atomic<bool> retired = { false }; // Set once its thread exits or drops it from its cache.
+		Producer *next = nullptr;
+	};
+
+	// Each thread keeps its producers for the last few queues it pushed to, so a thread feeding
+	// both the rendering and physics servers doesn't register a new producer on every switch.
+	// Producers dropped from the cache or left behind by an exiting thread are retired, and the
+	// consumer frees them once it has read all their commands.
+	struct ProducerCache {
+		static const uint32_t SIZE = 4;
+
+		struct Entry {
+			uint64_t queue_id = 0;
+			Producer *producer = nullptr;
+		};
+
+		Entry entries[SIZE];
+		uint32_t next_slot = 0;
+
+		~ProducerCache();
+	};
+
+	static thread_local ProducerCache producer_cache;
+	static std::atomic<uint64_t> last_queue_id;
+
+	// Queues alive, so exiting threads only retire producers of queues that still exist.
+	static SpinLock live_queues_lock;
+	static LocalVector<CommandQueueMT *> live_queues;
+
+	uint64_t queue_id = 0;
+	std::atomic<Producer *> producers = { nullptr };
+	std::atomic<uint32_t> retired_producers = { 0 }; // Retired but not freed yet.
+	std::atomic<uint64_t> next_ticket = { 0 };
+	std::atomic<bool> pending = { false };
+	std::atomic<WorkerThreadPool::TaskID> pump_task_id = { WorkerThreadPool::INVALID_TASK_ID };
+
+	// Recycled blocks of the default size. Only touched when a producer fills a block.
+	SpinLock free_blocks_lock;
+	LocalVector<Block *> free_blocks;
+
+	// Consumer side.
+	BinaryMutex flush_mutex;
+	std::atomic<bool> flushing = { false };
+	uint64_t read_ticket = 0;
+	Producer *read_producer = nullptr;
+
+	// Sync commands are the only ones that wait, so they are the only ones that lock.
 	BinaryMutex mutex;
-	LocalVector<uint8_t> command_mem;
 	ConditionVariable sync_cond_var;
-	uint32_t sync_head = 0;
-	uint32_t sync_tail = 0;
-	uint32_t sync_awaiters = 0;
-	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
-	uint64_t flush_read_ptr = 0;
-	std::atomic<bool> pending;
-
-	template <typename T, typename... Args>
-	_FORCE_INLINE_ void create_command(Args &&...p_args) {
-		// alloc size is size+T+safeguard
-		constexpr uint64_t alloc_size = ((sizeof(T) + 8U - 1U) & ~(8U - 1U));
-		static_assert(alloc_size < UINT32_MAX, "Type too large to fit in the command queue.");
-
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + sizeof(uint64_t));
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		void *cmd = &command_mem[size + sizeof(uint64_t)];
-		new (cmd) T(std::forward<Args>(p_args)...);
-		pending.store(true);
+	std::atomic<uint64_t> synced_ticket = { 0 };
+
+	Block *_alloc_block(uint32_t p_min_capacity);
+	void _free_block(Block *p_block);
+	Block *_next_block(Producer *p_producer, uint32_t p_min_capacity);
+	Producer *_register_producer();
+	static void _retire_producer(uint64_t p_queue_id, Producer *p_producer);
+	void _free_retired_producers();
+	CommandHeader *_peek_command(Producer *p_producer);
+	CommandHeader *_wait_for_command(uint64_t p_ticket);
+	void _notify_pump();
+
+	_FORCE_INLINE_ Producer *_get_producer() {
+		for (uint32_t i = 0; i < ProducerCache::SIZE; i++) {
+			if (likely(producer_cache.entries[i].queue_id == queue_id)) {
+				return producer_cache.entries[i].producer;
+			}
+		}
+		return _register_producer();
 	}
 
 	template <typename T, bool NeedsSync, typename... Args>
 	_FORCE_INLINE_ void _push_internal(Args &&...args) {
-		MutexLock mlock(mutex);
-		create_command<T>(std::forward<Args>(args)...);
+		// alloc size is size+T+safeguard
+		constexpr uint64_t alloc_size = ((sizeof(T) + 8U - 1U) & ~(8U - 1U));
+		static_assert(alloc_size < UINT32_MAX / 2, "Type too large to fit in the command queue.");
+		constexpr uint32_t needed = sizeof(CommandHeader) + alloc_size;
 
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+		Producer *producer = _get_producer();
+		Block *block = producer->write_block;
+		if (unlikely(block->write_pos + needed > block->capacity)) {
+			block = _next_block(producer, needed);
 		}
 
-		if constexpr (NeedsSync) {
-			sync_tail++;
-			_wait_for_sync(mlock);
+		// The block is already reachable by the consumer, so it never waits for a ticket it can't find.
+		const uint64_t ticket = next_ticket.fetch_add(1, std::memory_order_acq_rel);
+		CommandHeader *header = reinterpret_cast<CommandHeader *>(block->get_data() + block->write_pos);
+		header->ticket = ticket;
+		header->size = alloc_size;
+		new (header + 1) T(std::forward<Args>(args)...);
+		block->write_pos += needed;
+		block->committed.store(block->write_pos, std::memory_order_release);
+
+		// Only wake the pump on the transition to pending, it will drain everything pushed meanwhile.
+		if (!pending.exchange(true, std::memory_order_acq_rel)) {
+			_notify_pump();
 		}
-	}
 
-	_FORCE_INLINE_ void _prevent_sync_wraparound() {
-		bool safe_to_reset = !sync_awaiters;
-		bool already_sync_to_latest = sync_head == sync_tail;
-		if (safe_to_reset && already_sync_to_latest) {
-			sync_head = 0;
-			sync_tail = 0;
+		if constexpr (NeedsSync) {
+			_wait_for_sync(ticket);
 		}
 	}
 
-	void _flush() {
-		if (unlikely(flush_read_ptr)) {
-			// Re-entrant call.
-			return;
-		}
+	void _flush();
 
+	_FORCE_INLINE_ void _wait_for_sync(uint64_t p_ticket) {
 		MutexLock lock(mutex);
-
-		while (flush_read_ptr < command_mem.size()) {
-			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
-			flush_read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(lock);
-			cmd->call();
-			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
-
-			// Handle potential realloc due to the command and unlock allowance.
-			cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-
-			if (unlikely(cmd->sync)) {
-				sync_head++;
-				lock.~MutexLock(); // Give an opportunity to awaiters right away.
-				sync_cond_var.notify_all();
-				new (&lock) MutexLock(mutex);
-				// Handle potential realloc happened during unlock.
-				cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			}
-
-			cmd->~CommandBase();
-
-			flush_read_ptr += size;
+		while (synced_ticket.load(std::memory_order_acquire) <= p_ticket) {
+			sync_cond_var.wait(lock);
 		}
-
-		command_mem.clear();
-		pending.store(false);
-		flush_read_ptr = 0;
-
-		_prevent_sync_wraparound();
-	}
-
-	_FORCE_INLINE_ void _wait_for_sync(MutexLock<BinaryMutex> &p_lock) {
-		sync_awaiters++;
-		uint32_t sync_head_goal = sync_tail;
-		do {
-			sync_cond_var.wait(p_lock);
-		} while (sync_head < sync_head_goal);
-		sync_awaiters--;
-		_prevent_sync_wraparound();
 	}
 
 	void _no_op() {}
@@ -231,7 +268,7 @@ public:
 	}
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(pending.load())) {
+		if (unlikely(pending.load(std::memory_order_acquire))) {
 			_flush();
 		}
 	}
@@ -245,16 +282,21 @@ public:
 	}
 
 	void wait_and_flush() {
-		ERR_FAIL_COND(pump_task_id == WorkerThreadPool::INVALID_TASK_ID);
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
+		ERR_FAIL_COND(pump_task_id.load(std::memory_order_acquire) == WorkerThreadPool::INVALID_TASK_ID);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id.load(std::memory_order_acquire));
 		_flush();
 	}
 
 	void set_pump_task_id(WorkerThreadPool::TaskID p_task_id) {
-		MutexLock lock(mutex);
-		pump_task_id = p_task_id;
+		pump_task_id.store(p_task_id, std::memory_order_release);
+		if (pending.load(std::memory_order_acquire)) {
+			_notify_pump(); // Commands pushed before the pump existed.
+		}
 	}
 
+	// Producers currently registered, including retired ones not freed yet.
+	uint32_t get_producer_count();
+
 	CommandQueueMT();
 	~CommandQueueMT();
 };
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  hash_group.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef HASH_GROUP_H
+#define HASH_GROUP_H
+
+#include "core/typedefs.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HASH_GROUP_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HASH_GROUP_NEON
+#include <arm_neon.h>
+#endif
+
+// Compares the 32-bit hashes of several consecutive slots of an open-addressing
+// hash table at once, so lookups can skip through a probe sequence a group at a
+// time instead of slot by slot. Used by AHashMap and HashSet.
+// Slots holding a hash of 0 are free, as both tables reserve it as EMPTY_HASH.
+struct HashGroup {
+	static constexpr uint32_t WIDTH = 4;
+
+	// Bit `i` of the result is set if `p_hashes[i] == p_hash`, and bit `i` of
+	// `r_empty` is set if slot `i` is free.
+	static _FORCE_INLINE_ uint32_t match(const uint32_t *p_hashes, uint32_t p_hash, uint32_t &r_empty) {
+#if defined(HASH_GROUP_SSE2)
+		const __m128i hashes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_hashes));
+		return _match_sse2(hashes, p_hash, r_empty);
+#elif defined(HASH_GROUP_NEON)
+		return _match_neon(vld1q_u32(p_hashes), p_hash, r_empty);
+#else
+		return _match_scalar(p_hashes, 1, p_hash, r_empty);
+#endif
+	}
+
+	// Same as `match()`, for slots made of a 32-bit hash followed by a 32-bit payload.
+	static _FORCE_INLINE_ uint32_t match_interleaved(const uint32_t *p_slots, uint32_t p_hash, uint32_t &r_empty) {
+#if defined(HASH_GROUP_SSE2)
+		const __m128 lo = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_slots)));
+		const __m128 hi = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_slots + 4)));
+		const __m128i hashes = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+		return _match_sse2(hashes, p_hash, r_empty);
+#elif defined(HASH_GROUP_NEON)
+		return _match_neon(vld2q_u32(p_slots).val[0], p_hash, r_empty);
+#else
+		return _match_scalar(p_slots, 2, p_hash, r_empty);
+#endif
+	}
+
+	// Mask of the slots preceding the first free one, which are the only ones
+	// a key can be found in.
+	static _FORCE_INLINE_ uint32_t before_first_empty(uint32_t p_empty) {
+		return p_empty ? (p_empty & (0u - p_empty)) - 1 : (1u << WIDTH) - 1;
+	}
+
+private:
+#if defined(HASH_GROUP_SSE2)
+	static _FORCE_INLINE_ uint32_t _match_sse2(__m128i p_hashes, uint32_t p_hash, uint32_t &r_empty) {
+		r_empty = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(p_hashes, _mm_setzero_si128())));
+		return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(p_hashes, _mm_set1_epi32(p_hash))));
+	}
+#elif defined(HASH_GROUP_NEON)
+	static _FORCE_INLINE_ uint32_t _match_neon(uint32x4_t p_hashes, uint32_t p_hash, uint32_t &r_empty) {
+		static const uint32_t bits[4] = { 1, 2, 4, 8 };
+		const uint32x4_t lanes = vld1q_u32(bits);
+		r_empty = vaddvq_u32(vandq_u32(vceqq_u32(p_hashes, vdupq_n_u32(0)), lanes));
+		return vaddvq_u32(vandq_u32(vceqq_u32(p_hashes, vdupq_n_u32(p_hash)), lanes));
+	}
+#else
+	static _FORCE_INLINE_ uint32_t _match_scalar(const uint32_t *p_hashes, uint32_t p_stride, uint32_t p_hash, uint32_t &r_empty) {
+		uint32_t found = 0;
+		r_empty = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			const uint32_t hash = p_hashes[i * p_stride];
+			found |= uint32_t(hash == p_hash) << i;
+			r_empty |= uint32_t(hash == 0) << i;
+		}
+		return found;
+	}
+#endif
+};
+
+#endif // HASH_GROUP_H
@@ -35,6 +35,7 @@
 
 #include "core/math/math_funcs.h"
 #include "core/os/memory.h"
+#include "core/templates/hash_group.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hashfuncs.h"
 #include "core/templates/paged_allocator.h"
@@ -108,6 +109,61 @@ private:
 
 			pos = fastmod(pos + 1, capacity_inv, capacity);
 			distance++;
+
+			if (unlikely(distance == HashGroup::WIDTH)) {
+				return _lookup_pos_in_groups(p_key, r_pos, hash, pos, distance);
+			}
+		}
+	}
+
+	// Continues a long probe sequence, comparing a group of slots at a time.
+	// Most lookups end within the first few slots, where probing one slot at a time is cheaper.
+	bool _lookup_pos_in_groups(const TKey &p_key, uint32_t &r_pos, uint32_t p_hash, uint32_t p_pos, uint32_t p_distance) const {
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t pos = p_pos;
+		uint32_t distance = p_distance;
+
+		while (true) {
+			if (likely(pos + HashGroup::WIDTH <= capacity)) {
+				uint32_t empty;
+				uint32_t match = HashGroup::match(&hashes[pos], p_hash, empty);
+				match &= HashGroup::before_first_empty(empty);
+				for (uint32_t i = 0; match != 0; i++, match >>= 1) {
+					if ((match & 1) && Comparator::compare(keys[hash_to_key[pos + i]], p_key)) {
+						r_pos = hash_to_key[pos + i];
+						return true;
+					}
+				}
+
+				if (empty != 0) {
+					return false;
+				}
+
+				// Only the last slot of the group needs checking against the probe length.
+				pos += HashGroup::WIDTH - 1;
+				distance += HashGroup::WIDTH - 1;
+				if (distance > _get_probe_length(pos, hashes[pos], capacity, capacity_inv)) {
+					return false;
+				}
+			} else {
+				// The group would wrap around, probe a single slot.
+				if (hashes[pos] == EMPTY_HASH) {
+					return false;
+				}
+
+				if (distance > _get_probe_length(pos, hashes[pos], capacity, capacity_inv)) {
+					return false;
+				}
+
+				if (hashes[pos] == p_hash && Comparator::compare(keys[hash_to_key[pos]], p_key)) {
+					r_pos = hash_to_key[pos];
+					return true;
+				}
+			}
+
+			pos = fastmod(pos + 1, capacity_inv, capacity);
+			distance++;
 		}
 	}
 
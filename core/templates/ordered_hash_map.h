@@ -0,0 +1,676 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef ORDERED_HASH_MAP_H
+#define ORDERED_HASH_MAP_H
+
+#include "core/templates/a_hash_map.h"
+#include "core/templates/sort_array.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+template <typename TKey, typename TValue>
+struct OrderedHashMapElement {
+	KeyValue<TKey, TValue> data;
+	uint32_t hash; // EMPTY_HASH while the slot is free.
+	uint32_t prev; // Neighbors in insertion order, INVALID_INDEX at the ends.
+	uint32_t next; // While the slot is free, the next free slot instead.
+};
+
+/**
+ * A hash map that preserves insertion order and stores its elements in a few large blocks.
+ *
+ * Elements live in slots of segments that double in size as the map grows, and an
+ * index table (the same Robin Hood table as AHashMap) maps hashes to slots. Insertion
+ * order is a list linked through slot indices, so slots freed by erasing are reused
+ * without disturbing the order of the others.
+ *
+ * Unlike HashMap, there is no allocation per element and iterating mostly walks
+ * memory in order. Unlike AHashMap, elements never move: as with HashMap, pointers
+ * to keys and values stay valid until the element is erased or the map is cleared.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t INITIAL_CAPACITY = 16;
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+	static_assert(EMPTY_HASH == 0, "EMPTY_HASH must always be 0 for the memset() optimization.");
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+	typedef OrderedHashMapElement<TKey, TValue> MapElement;
+
+	// Segment `s` holds the slots from `(2^s - 1) << SEGMENT_SHIFT` on, `1 << (SEGMENT_SHIFT + s)` of them.
+	static constexpr uint32_t SEGMENT_SHIFT = 2;
+
+	MapElement **segments = nullptr;
+	HashMapData *map_data = nullptr;
+
+	// Capacity of the index table. Due to optimization, this is `capacity - 1`. Use + 1 to get normal capacity.
+	uint32_t capacity = 0;
+	uint32_t num_elements = 0;
+	uint32_t num_segments = 0;
+	// Slots handed out so far, including free ones. The ones past it were never used.
+	uint32_t num_slots = 0;
+	uint32_t free_slot = INVALID_INDEX;
+	uint32_t head = INVALID_INDEX;
+	uint32_t tail = INVALID_INDEX;
+	// Whether slot `i` holds the `i`-th element, so get_by_index() doesn't need to walk the list.
+	bool in_slot_order = true;
+
+	uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_resize_count(uint32_t p_capacity) {
+		return p_capacity ^ (p_capacity + 1) >> 2; // = get_capacity() * 0.75 - 1; Works only if p_capacity = 2^n - 1.
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_pos, uint32_t p_hash, uint32_t p_local_capacity) {
+		const uint32_t original_pos = p_hash & p_local_capacity;
+		return (p_pos - original_pos + p_local_capacity + 1) & p_local_capacity;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_segment(uint32_t p_slot) {
+		// Index of the highest bit set.
+		const uint32_t value = (p_slot >> SEGMENT_SHIFT) + 1;
+#if defined(__GNUC__) || defined(__clang__)
+		return 31 - __builtin_clz(value);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse(&index, value);
+		return index;
+#else
+		uint32_t index = 0;
+		while (value >> (index + 1)) {
+			index++;
+		}
+		return index;
+#endif
+	}
+
+	_FORCE_INLINE_ MapElement *_get_element(uint32_t p_slot) const {
+		const uint32_t segment = _get_segment(p_slot);
+		return segments[segment] + (p_slot - (((1u << segment) - 1) << SEGMENT_SHIFT));
+	}
+
+	_FORCE_INLINE_ MapElement *_get_element_or_null(uint32_t p_slot) const {
+		return p_slot == INVALID_INDEX ? nullptr : _get_element(p_slot);
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos, uint32_t &r_hash_pos) const {
+		if (unlikely(map_data == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+		return _lookup_pos_with_hash(p_key, r_pos, r_hash_pos, _hash(p_key));
+	}
+
+	bool _lookup_pos_with_hash(const TKey &p_key, uint32_t &r_pos, uint32_t &r_hash_pos, uint32_t p_hash) const {
+		if (unlikely(map_data == nullptr)) {
+			return false; // Failed lookups, no elements.
+		}
+
+		uint32_t pos = p_hash & capacity;
+		uint32_t distance = 0;
+		while (true) {
+			HashMapData data = map_data[pos];
+			if (data.hash == p_hash && Comparator::compare(_get_element(data.hash_to_key)->data.key, p_key)) {
+				r_pos = data.hash_to_key;
+				r_hash_pos = pos;
+				return true;
+			}
+
+			if (data.data == EMPTY_HASH) {
+				return false;
+			}
+
+			if (distance > _get_probe_length(pos, data.hash, capacity)) {
+				return false;
+			}
+
+			pos = (pos + 1) & capacity;
+			distance++;
+		}
+	}
+
+	void _insert_with_hash(uint32_t p_hash, uint32_t p_slot) {
+		uint32_t pos = p_hash & capacity;
+		uint32_t distance = 0;
+		HashMapData c_data;
+		c_data.hash = p_hash;
+		c_data.hash_to_key = p_slot;
+
+		while (true) {
+			if (map_data[pos].data == EMPTY_HASH) {
+				map_data[pos] = c_data;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, map_data[pos].hash, capacity);
+			if (existing_probe_len < distance) {
+				SWAP(c_data, map_data[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = (pos + 1) & capacity;
+			distance++;
+		}
+	}
+
+	void _rehash() {
+		memset(map_data, EMPTY_HASH, (capacity + 1) * sizeof(HashMapData));
+		for (uint32_t slot = head; slot != INVALID_INDEX;) {
+			const MapElement *E = _get_element(slot);
+			_insert_with_hash(E->hash, slot);
+			slot = E->next;
+		}
+	}
+
+	// Only the index table is reallocated, the elements stay where they are.
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		capacity = p_new_capacity;
+		Memory::free_static(map_data);
+		map_data = reinterpret_cast<HashMapData *>(Memory::alloc_static(sizeof(HashMapData) * (capacity + 1)));
+		_rehash();
+	}
+
+	void _add_segment() {
+		segments = reinterpret_cast<MapElement **>(Memory::realloc_static(segments, sizeof(MapElement *) * (num_segments + 1)));
+		segments[num_segments] = reinterpret_cast<MapElement *>(Memory::alloc_static(sizeof(MapElement) << (SEGMENT_SHIFT + num_segments)));
+		num_segments++;
+	}
+
+	uint32_t _alloc_slot() {
+		if (free_slot != INVALID_INDEX) {
+			const uint32_t slot = free_slot;
+			free_slot = _get_element(slot)->next;
+			return slot;
+		}
+		if (num_slots == ((1u << num_segments) - 1) << SEGMENT_SHIFT) {
+			_add_segment();
+		}
+		return num_slots++;
+	}
+
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(map_data == nullptr)) {
+			// Allocate on demand to save memory.
+			map_data = reinterpret_cast<HashMapData *>(Memory::alloc_static(sizeof(HashMapData) * (capacity + 1)));
+			memset(map_data, EMPTY_HASH, (capacity + 1) * sizeof(HashMapData));
+		}
+
+		if (unlikely(num_elements > _get_resize_count(capacity))) {
+			_resize_and_rehash(capacity * 2 + 1);
+		}
+
+		// Nothing moves here, so the key or value may belong to this map.
+		const uint32_t slot = _alloc_slot();
+		MapElement *E = _get_element(slot);
+		memnew_placement(&E->data, MapKeyValue(p_key, p_value));
+		E->hash = p_hash;
+		E->prev = tail;
+		E->next = INVALID_INDEX;
+		if (tail != INVALID_INDEX) {
+			_get_element(tail)->next = slot;
+		} else {
+			head = slot;
+		}
+		tail = slot;
+		if (slot != num_elements) {
+			in_slot_order = false; // Took a freed slot.
+		}
+
+		_insert_with_hash(p_hash, slot);
+		num_elements++;
+		return slot;
+	}
+
+	void _init_from(const OrderedHashMap &p_other) {
+		capacity = p_other.capacity;
+		for (uint32_t slot = p_other.head; slot != INVALID_INDEX;) {
+			const MapElement *E = p_other._get_element(slot);
+			_insert_element(E->data.key, E->data.value, E->hash);
+			slot = E->next;
+		}
+	}
+
+	struct ElementIndexSort {
+		const OrderedHashMap *map = nullptr;
+		_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+			return _hashmap_variant_less_than(map->_get_element(p_a)->data.key, map->_get_element(p_b)->data.key);
+		}
+	};
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity + 1; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (map_data == nullptr || num_elements == 0) {
+			return;
+		}
+
+		memset(map_data, EMPTY_HASH, (capacity + 1) * sizeof(HashMapData));
+		for (uint32_t slot = head; slot != INVALID_INDEX;) {
+			MapElement *E = _get_element(slot);
+			slot = E->next;
+			E->data.~MapKeyValue();
+			E->hash = EMPTY_HASH;
+		}
+
+		// The segments are kept for reuse.
+		num_elements = 0;
+		num_slots = 0;
+		free_slot = INVALID_INDEX;
+		head = INVALID_INDEX;
+		tail = INVALID_INDEX;
+		in_slot_order = true;
+	}
+
+	// Sorts by key, as HashMap::sort() does. Only relinks the elements, none of them move.
+	void sort() {
+		if (num_elements < 2) {
+			return; // An empty or single element map is already sorted.
+		}
+
+		uint32_t *order = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * num_elements));
+		uint32_t count = 0;
+		for (uint32_t slot = head; slot != INVALID_INDEX; slot = _get_element(slot)->next) {
+			order[count++] = slot;
+		}
+		SortArray<uint32_t, ElementIndexSort> sorter;
+		sorter.compare.map = this;
+		sorter.sort(order, num_elements);
+
+		in_slot_order = true;
+		for (uint32_t i = 0; i < num_elements; i++) {
+			MapElement *E = _get_element(order[i]);
+			E->prev = i > 0 ? order[i - 1] : INVALID_INDEX;
+			E->next = i + 1 < num_elements ? order[i + 1] : INVALID_INDEX;
+			in_slot_order = in_slot_order && order[i] == i;
+		}
+		head = order[0];
+		tail = order[num_elements - 1];
+		Memory::free_static(order);
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, hash_pos);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return _get_element(pos)->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, hash_pos);
+		CRASH_COND_MSG(!exists, "OrderedHashMap key not found.");
+		return _get_element(pos)->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, hash_pos);
+		if (exists) {
+			return &_get_element(pos)->data.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t hash_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, hash_pos);
+		if (exists) {
+			return &_get_element(pos)->data.value;
+		}
+		return nullptr;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		uint32_t h_pos = 0;
+		return _lookup_pos(p_key, _pos, h_pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t slot = 0;
+		bool exists = _lookup_pos(p_key, slot, pos);
+
+		if (!exists) {
+			return false;
+		}
+
+		uint32_t next_pos = (pos + 1) & capacity;
+		while (map_data[next_pos].hash != EMPTY_HASH && _get_probe_length(next_pos, map_data[next_pos].hash, capacity) != 0) {
+			SWAP(map_data[next_pos], map_data[pos]);
+
+			pos = next_pos;
+			next_pos = (next_pos + 1) & capacity;
+		}
+
+		map_data[pos].data = EMPTY_HASH;
+
+		MapElement *E = _get_element(slot);
+		if (E->prev != INVALID_INDEX) {
+			_get_element(E->prev)->next = E->next;
+		} else {
+			head = E->next;
+		}
+		if (E->next != INVALID_INDEX) {
+			_get_element(E->next)->prev = E->prev;
+		} else {
+			tail = E->prev;
+		}
+
+		E->data.~MapKeyValue();
+		E->hash = EMPTY_HASH;
+		num_elements--;
+
+		if (num_elements == 0) {
+			// Nothing left to keep in place, start over from the first slot.
+			num_slots = 0;
+			free_slot = INVALID_INDEX;
+			in_slot_order = true;
+		} else if (slot == num_slots - 1 && in_slot_order) {
+			// The last element, the order of the others still matches their slots.
+			num_slots--;
+		} else {
+			E->next = free_slot;
+			free_slot = slot;
+			in_slot_order = false;
+		}
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = next_power_of_2(MAX(4u, p_new_capacity + p_new_capacity / 3 + 1)) - 1;
+		if (new_capacity <= capacity) {
+			return;
+		}
+		if (map_data == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return E->data;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return &E->data;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			E = map->_get_element_or_null(E->next);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != nullptr;
+		}
+
+		_FORCE_INLINE_ ConstIterator(MapElement *p_E, const OrderedHashMap *p_map) {
+			E = p_E;
+			map = p_map;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			E = p_it.E;
+			map = p_it.map;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			E = p_it.E;
+			map = p_it.map;
+		}
+
+	private:
+		MapElement *E = nullptr;
+		const OrderedHashMap *map = nullptr;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return E->data;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return &E->data;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			E = map->_get_element_or_null(E->next);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return E != nullptr;
+		}
+
+		_FORCE_INLINE_ Iterator(MapElement *p_E, const OrderedHashMap *p_map) {
+			E = p_E;
+			map = p_map;
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			E = p_it.E;
+			map = p_it.map;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			E = p_it.E;
+			map = p_it.map;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(E, map);
+		}
+
+	private:
+		MapElement *E = nullptr;
+		const OrderedHashMap *map = nullptr;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(_get_element_or_null(head), this);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr, this);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t h_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, h_pos);
+		if (!exists) {
+			return end();
+		}
+		return Iterator(_get_element(pos), this);
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(_get_element_or_null(head), this);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr, this);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t h_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, h_pos);
+		if (!exists) {
+			return end();
+		}
+		return ConstIterator(_get_element(pos), this);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		uint32_t h_pos = 0;
+		bool exists = _lookup_pos(p_key, pos, h_pos);
+		CRASH_COND(!exists);
+		return _get_element(pos)->data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		uint32_t h_pos = 0;
+		uint32_t hash = _hash(p_key);
+		bool exists = _lookup_pos_with_hash(p_key, pos, h_pos, hash);
+
+		if (!exists) {
+			pos = _insert_element(p_key, TValue(), hash);
+		}
+		return _get_element(pos)->data.value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t pos = 0;
+		uint32_t h_pos = 0;
+		uint32_t hash = _hash(p_key);
+		bool exists = _lookup_pos_with_hash(p_key, pos, h_pos, hash);
+
+		if (!exists) {
+			pos = _insert_element(p_key, p_value, hash);
+		} else {
+			_get_element(pos)->data.value = p_value;
+		}
+		return Iterator(_get_element(pos), this);
+	}
+
+	/* Array methods. */
+
+	// Returns the element at `p_index` in insertion order. Constant time unless elements were erased or sorted.
+	const MapKeyValue &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		if (in_slot_order) {
+			return _get_element(p_index)->data;
+		}
+		const MapElement *E = _get_element(head);
+		for (uint32_t i = 0; i < p_index; i++) {
+			E = _get_element(E->next);
+		}
+		return E->data;
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		_init_from(p_other);
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		reset();
+
+		_init_from(p_other);
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) :
+			capacity(INITIAL_CAPACITY - 1) {
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() :
+			capacity(INITIAL_CAPACITY - 1) {
+	}
+
+	OrderedHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) :
+			capacity(INITIAL_CAPACITY - 1) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void reset() {
+		clear();
+		for (uint32_t i = 0; i < num_segments; i++) {
+			Memory::free_static(segments[i]);
+		}
+		if (segments != nullptr) {
+			Memory::free_static(segments);
+			segments = nullptr;
+		}
+		if (map_data != nullptr) {
+			Memory::free_static(map_data);
+			map_data = nullptr;
+		}
+		capacity = INITIAL_CAPACITY - 1;
+		num_segments = 0;
+	}
+
+	~OrderedHashMap() {
+		reset();
+	}
+};
+
+#endif // ORDERED_HASH_MAP_H
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  work_stealing_deque.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include "core/typedefs.h"
+
+#include <atomic>
+#include <type_traits>
+
+// Bounded Chase-Lev work-stealing deque.
+// - The owner thread pushes and pops at the bottom end (LIFO) without locking.
+// - Any other thread can steal from the top end (FIFO) with a single CAS.
+// - When full, push() fails and the caller is expected to fall back to a shared queue.
+// Elements must be trivially copyable (typically pointers).
+// See "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., 2013).
+
+template <typename T, uint32_t CAPACITY = 1024>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque only supports trivially copyable types.");
+	static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "WorkStealingDeque capacity must be a power of two.");
+
+	static constexpr int64_t MASK = CAPACITY - 1;
+	static constexpr size_t CACHE_LINE_SIZE = 64;
+
+	// Top and bottom live on separate cache lines, as they are written by different threads.
+	std::atomic<int64_t> top = 0;
+	uint8_t _pad0[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+	std::atomic<int64_t> bottom = 0;
+	uint8_t _pad1[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+	std::atomic<T> buffer[CAPACITY];
+
+public:
+	// Owner thread only.
+	_FORCE_INLINE_ bool push(T p_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		if (unlikely(b - t >= (int64_t)CAPACITY)) {
+			return false;
+		}
+		buffer[b & MASK].store(p_value, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Owner thread only.
+	_FORCE_INLINE_ bool pop(T &r_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		r_value = buffer[b & MASK].load(std::memory_order_relaxed);
+		if (t != b) {
+			// More than one element left, no thief can reach this one.
+			return true;
+		}
+
+		// Last element, race against thieves for it.
+		bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return won;
+	}
+
+	// Any thread. May fail spuriously if another thief or the owner wins the race for the same element.
+	_FORCE_INLINE_ bool steal(T &r_value) {
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t b = bottom.load(std::memory_order_acquire);
+
+		if (t >= b) {
+			return false;
+		}
+
+		T value = buffer[t & MASK].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return false;
+		}
+		r_value = value;
+		return true;
+	}
+
+	// Any thread. Only a hint when called concurrently with push/pop/steal.
+	_FORCE_INLINE_ uint32_t size_approx() const {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_relaxed);
+		return b > t ? uint32_t(b - t) : 0;
+	}
+
+	_FORCE_INLINE_ bool is_empty() const { return size_approx() == 0; }
+
+	static constexpr uint32_t get_capacity() { return CAPACITY; }
+
+	WorkStealingDeque() {}
+	WorkStealingDeque(const WorkStealingDeque &) = delete;
+	WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+};
+
+#endif // WORK_STEALING_DEQUE_H
@@ -281,6 +281,7 @@ void Array::assign(const Array &p_array) {
 
 void Array::push_back(const Variant &p_value) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	Variant value = p_value;
 	ERR_FAIL_COND(!_p->typed.validate(value, "push_back"));
 	_p->array.push_back(value);
@@ -288,6 +289,7 @@ void Array::push_back(const Variant &p_value) {
 
 void Array::append_array(const Array &p_array) {
 	ERR_FAIL_COND_MSG(_p->read_only, "Array is in read-only state.");
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 
 	Vector<Variant> validated_array = p_array._p->array;
 	for (int i = 0; i < validated_array.size(); ++i) {
@@ -299,6 +301,7 @@ void Array::append_array(const Array &p_array) {
 
 Error Array::resize(int p_new_size) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, ERR_LOCKED, "Array is in read-only state.");
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	Variant::Type &variant_type = _p->typed.type;
 	int old_size = _p->array.size();
 	Error err = _p->array.resize_zeroed(p_new_size);
@@ -312,6 +315,7 @@ Error Array::resize(int p_new_size) {
 
 Error Array::insert(int p_pos, const Variant &p_value) {
 	ERR_FAIL_COND_V_MSG(_p->read_only, ERR_LOCKED, "Array is in read-only state.");
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	Variant value = p_value;
 	ERR_FAIL_COND_V(!_p->typed.validate(value, "insert"), ERR_INVALID_PARAMETER);
 	return _p->array.insert(p_pos, value);
@@ -837,6 +841,7 @@ const void *Array::id() const {
 }
 
 Array::Array(const Array &p_from, uint32_t p_type, const StringName &p_class_name, const Variant &p_script) {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	_p = memnew(ArrayPrivate);
 	_p->refcount.init();
 	set_typed(p_type, p_class_name, p_script);
@@ -916,6 +921,7 @@ Array::Array(const Array &p_from) {
 }
 
 Array::Array() {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	_p = memnew(ArrayPrivate);
 	_p->refcount.init();
 }
@@ -0,0 +1,211 @@
+/**************************************************************************/
+/*  array_view.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "array_view.h"
+
+#include "core/object/class_db.h"
+
+void ArrayView::_resolve_range(int p_size, int &r_begin, int &r_end) {
+	// Negative indices count from the end, as in Array.slice(), and the range is clamped to the array.
+	if (r_begin < 0) {
+		r_begin += p_size;
+	}
+	if (r_end < 0) {
+		r_end += p_size;
+	}
+	r_begin = CLAMP(r_begin, 0, p_size);
+	r_end = CLAMP(r_end, r_begin, p_size);
+}
+
+Variant ArrayView::_slice(const Variant &p_source, int p_begin, int p_end) {
+	switch (p_source.get_type()) {
+		case Variant::ARRAY:
+			return Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_BYTE_ARRAY:
+			return PackedByteArray(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_INT32_ARRAY:
+			return PackedInt32Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_INT64_ARRAY:
+			return PackedInt64Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return PackedFloat32Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return PackedFloat64Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_STRING_ARRAY:
+			return PackedStringArray(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_VECTOR2_ARRAY:
+			return PackedVector2Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_VECTOR3_ARRAY:
+			return PackedVector3Array(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_COLOR_ARRAY:
+			return PackedColorArray(p_source).slice(p_begin, p_end);
+		case Variant::PACKED_VECTOR4_ARRAY:
+			return PackedVector4Array(p_source).slice(p_begin, p_end);
+		default:
+			ERR_FAIL_V(Variant());
+	}
+}
+
+Ref<ArrayView> ArrayView::create(const Variant &p_array, int p_begin, int p_end) {
+	ERR_FAIL_COND_V_MSG(!p_array.is_array(), Ref<ArrayView>(), "ArrayView can only be created from an Array or a packed array.");
+
+	_resolve_range(p_array.get_indexed_size(), p_begin, p_end);
+
+	Ref<ArrayView> view;
+	view.instantiate();
+	view->source = p_array;
+	view->offset = p_begin;
+	view->length = p_end - p_begin;
+	return view;
+}
+
+Variant ArrayView::get_at(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, length, Variant());
+
+	bool valid = false;
+	bool oob = true;
+	Variant ret = source.get_indexed(offset + p_index, valid, oob);
+	ERR_FAIL_COND_V_MSG(oob, Variant(), "The viewed Array was shrunk below the end of the view.");
+	return ret;
+}
+
+void ArrayView::set_at(int p_index, const Variant &p_value) {
+	ERR_FAIL_INDEX(p_index, length);
+
+	if (!detached) {
+		// First write, copy the window so the source stays untouched.
+		source = _slice(source, offset, offset + length);
+		ERR_FAIL_COND_MSG(int(source.get_indexed_size()) != length, "The viewed Array was shrunk below the end of the view.");
+		offset = 0;
+		detached = true;
+	}
+
+	bool valid = false;
+	bool oob = true;
+	source.set_indexed(p_index, p_value, valid, oob);
+	ERR_FAIL_COND_MSG(!valid, vformat("Unable to store a value of type \"%s\" in this view.", Variant::get_type_name(p_value.get_type())));
+}
+
+Ref<ArrayView> ArrayView::slice(int p_begin, int p_end) const {
+	_resolve_range(length, p_begin, p_end);
+
+	Ref<ArrayView> view;
+	view.instantiate();
+	view->source = source;
+	view->offset = offset + p_begin;
+	view->length = p_end - p_begin;
+	// If this view was written to, the new one references its copy, until it is written to itself.
+	return view;
+}
+
+Variant ArrayView::to_array() const {
+	return _slice(source, offset, offset + length);
+}
+
+Variant ArrayView::_iter_init(const Array &p_iter) {
+	Array ref = p_iter;
+	if (length == 0 || ref.size() != 1) {
+		return false;
+	}
+	ref[0] = 0;
+	return true;
+}
+
+Variant ArrayView::_iter_next(const Array &p_iter) {
+	Array ref = p_iter;
+	if (ref.size() != 1) {
+		return false;
+	}
+	int pos = ref[0];
+	if (pos < 0 || pos >= length) {
+		return false;
+	}
+	pos += 1;
+	ref[0] = pos;
+	return pos != length;
+}
+
+Variant ArrayView::_iter_get(const Variant &p_iter) {
+	return get_at(p_iter);
+}
+
+Variant ArrayView::getvar(const Variant &p_key, bool *r_valid) const {
+	if (p_key.get_type() != Variant::INT) {
+		return RefCounted::getvar(p_key, r_valid);
+	}
+
+	int index = p_key;
+	if (index < 0) {
+		index += length;
+	}
+	if (r_valid) {
+		*r_valid = index >= 0 && index < length;
+	}
+	if (index < 0 || index >= length) {
+		return Variant();
+	}
+	return get_at(index);
+}
+
+void ArrayView::setvar(const Variant &p_key, const Variant &p_value, bool *r_valid) {
+	if (p_key.get_type() != Variant::INT) {
+		RefCounted::setvar(p_key, p_value, r_valid);
+		return;
+	}
+
+	int index = p_key;
+	if (index < 0) {
+		index += length;
+	}
+	if (r_valid) {
+		*r_valid = index >= 0 && index < length;
+	}
+	if (index < 0 || index >= length) {
+		return;
+	}
+	set_at(index, p_value);
+}
+
+void ArrayView::_bind_methods() {
+	ClassDB::bind_static_method("ArrayView", D_METHOD("create", "array", "begin", "end"), &ArrayView::create, DEFVAL(0), DEFVAL(INT_MAX));
+
+	ClassDB::bind_method(D_METHOD("size"), &ArrayView::size);
+	ClassDB::bind_method(D_METHOD("is_empty"), &ArrayView::is_empty);
+	ClassDB::bind_method(D_METHOD("get_at", "index"), &ArrayView::get_at);
+	ClassDB::bind_method(D_METHOD("set_at", "index", "value"), &ArrayView::set_at);
+	ClassDB::bind_method(D_METHOD("slice", "begin", "end"), &ArrayView::slice, DEFVAL(INT_MAX));
+	ClassDB::bind_method(D_METHOD("to_array"), &ArrayView::to_array);
+
+	ClassDB::bind_method(D_METHOD("_iter_init"), &ArrayView::_iter_init);
+	ClassDB::bind_method(D_METHOD("_iter_get"), &ArrayView::_iter_get);
+	ClassDB::bind_method(D_METHOD("_iter_next"), &ArrayView::_iter_next);
+}
@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  array_view.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ARRAY_VIEW_H
+#define ARRAY_VIEW_H
+
+#include "core/object/ref_counted.h"
+
+// A window over an Array or a packed array, which doesn't copy its elements.
+// The view references its source as any other reference to the array would. An Array is
+// shared, so the view sees changes made to it. A packed array is copy-on-write, so the
+// view keeps the data it was created from, and while the view is alive the next write to
+// the source copies the whole source buffer. Writing through the view copies the window
+// first, so the source is never modified.
+class ArrayView : public RefCounted {
+	GDCLASS(ArrayView, RefCounted);
+
+	Variant source;
+	int offset = 0;
+	int length = 0;
+	bool detached = false;
+
+	static void _resolve_range(int p_size, int &r_begin, int &r_end);
+	static Variant _slice(const Variant &p_source, int p_begin, int p_end);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Ref<ArrayView> create(const Variant &p_array, int p_begin = 0, int p_end = INT_MAX);
+
+	int size() const { return length; }
+	bool is_empty() const { return length == 0; }
+
+	Variant get_at(int p_index) const;
+	void set_at(int p_index, const Variant &p_value);
+
+	Ref<ArrayView> slice(int p_begin, int p_end = INT_MAX) const;
+	Variant to_array() const;
+
+	Variant _iter_init(const Array &p_iter);
+	Variant _iter_next(const Array &p_iter);
+	Variant _iter_get(const Variant &p_iter);
+
+	virtual Variant getvar(const Variant &p_key, bool *r_valid = nullptr) const override;
+	virtual void setvar(const Variant &p_key, const Variant &p_value, bool *r_valid = nullptr) override;
+};
+
+#endif // ARRAY_VIEW_H
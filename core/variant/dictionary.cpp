@@ -32,7 +32,7 @@
 
 #include "dictionary.h"
 
-#include "core/templates/hash_map.h"
+#include "core/templates/ordered_hash_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/container_type_validate.h"
 #include "core/variant/variant.h"
@@ -45,7 +45,7 @@
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
 	ContainerTypeValidate typed_key;
 	ContainerTypeValidate typed_value;
 	Variant *typed_fallback = nullptr; // Allows a typed dictionary to return dummy values when attempting an invalid access.
@@ -62,27 +62,17 @@ void Dictionary::get_key_list(List<Variant> *p_keys) const {
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.key;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).key;
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.value;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).value;
 }
 
 // WARNING: This operator does not validate the value type. For scripting/extensions this is
@@ -104,6 +94,7 @@ Variant &Dictionary::operator[](const Variant &p_key) {
 		return *_p->read_only;
 	} else {
 		if (unlikely(!_p->variant_map.has(key))) {
+			MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 			VariantInternal::initialize(&_p->variant_map[key], _p->typed_value.type);
 		}
 		return _p->variant_map[key];
@@ -129,7 +120,7 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
 	if (!E) {
 		return nullptr;
 	}
@@ -142,7 +133,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key));
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key));
 	if (!E) {
 		return nullptr;
 	}
@@ -157,7 +148,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 Variant Dictionary::get_valid(const Variant &p_key) const {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "get_valid"), Variant());
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
 
 	if (!E) {
 		return Variant();
@@ -195,6 +186,7 @@ bool Dictionary::set(const Variant &p_key, const Variant &p_value) {
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "set"), false);
 	Variant value = p_value;
 	ERR_FAIL_COND_V(!_p->typed_value.validate(value, "set"), false);
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	_p->variant_map[key] = value;
 	return true;
 }
@@ -266,7 +258,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	}
 	recursion_count++;
 	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
+		OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
 		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count, false)) {
 			return false;
 		}
@@ -412,7 +404,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 	}
 
 	int size = p_dictionary._p->variant_map.size();
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>(size);
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map = OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>(size);
 
 	Vector<Variant> key_array;
 	key_array.resize(size);
@@ -545,7 +537,7 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	}
 	Variant key = *p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "next"), nullptr);
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
 
 	if (!E) {
 		return nullptr;
@@ -699,6 +691,7 @@ const void *Dictionary::id() const {
 }
 
 Dictionary::Dictionary(const Dictionary &p_base, uint32_t p_key_type, const StringName &p_key_class_name, const Variant &p_key_script, uint32_t p_value_type, const StringName &p_value_class_name, const Variant &p_value_script) {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	_p = memnew(DictionaryPrivate);
 	_p->refcount.init();
 	set_typed(p_key_type, p_key_class_name, p_key_script, p_value_type, p_value_class_name, p_value_script);
@@ -711,11 +704,13 @@ Dictionary::Dictionary(const Dictionary &p_from) {
 }
 
 Dictionary::Dictionary() {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	_p = memnew(DictionaryPrivate);
 	_p->refcount.init();
 }
 
 Dictionary::Dictionary(std::initializer_list<KeyValue<Variant, Variant>> p_init) {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_VARIANT);
 	_p = memnew(DictionaryPrivate);
 	_p->refcount.init();
 
@@ -39,6 +39,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -173,6 +174,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		munmap(mapped_data, mapped_size);
+		mapped_data = nullptr;
+		mapped_size = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -278,6 +285,32 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+const uint8_t *FileAccessUnix::map_read_only() {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (mapped_data) {
+		return (const uint8_t *)mapped_data;
+	}
+	if (flags != READ) {
+		return nullptr;
+	}
+
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+		return nullptr;
+	}
+
+	// Private mapping, so the pages are never written back even if the file changes on disk.
+	void *data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapped_data = data;
+	mapped_size = st.st_size;
+	return (const uint8_t *)mapped_data;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -43,6 +43,8 @@
 class FileAccessUnix : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
+	void *mapped_data = nullptr;
+	uint64_t mapped_size = 0;
 	void check_errors(bool p_write = false) const;
 	mutable Error last_error = OK;
 	String save_path;
@@ -73,6 +75,7 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *map_read_only() override;
 
 	virtual Error get_error() const override; ///< get last error
 
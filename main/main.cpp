@@ -50,6 +50,7 @@
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
@@ -2004,6 +2005,11 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GLOBAL_DEF("debug/settings/stdout/print_gpu_profile", false);
 	GLOBAL_DEF("debug/settings/stdout/verbose_stdout", false);
 	GLOBAL_DEF("debug/settings/physics_interpolation/enable_warnings", true);
+	GLOBAL_DEF("debug/settings/memory/allocation_tracking", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/memory/allocation_sample_interval", PROPERTY_HINT_RANGE, "1,65536,1,or_greater"), 1024);
+	if (GLOBAL_GET("debug/settings/memory/allocation_tracking")) {
+		Memory::set_allocation_tracking_enabled(true, GLOBAL_GET("debug/settings/memory/allocation_sample_interval"));
+	}
 	if (!OS::get_singleton()->_verbose_stdout) { // Not manually overridden.
 		OS::get_singleton()->_verbose_stdout = GLOBAL_GET("debug/settings/stdout/verbose_stdout");
 	}
@@ -4418,6 +4424,9 @@ static uint64_t navigation_process_max = 0;
 bool Main::iteration() {
 	iterating++;
 
+	// Per-frame temporaries from the previous iteration are no longer in use.
+	FrameArena::get_thread_arena().reset();
+
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -4564,6 +4573,8 @@ bool Main::iteration() {
 
 	AudioServer::get_singleton()->update();
 
+	Memory::end_allocation_frame();
+
 	if (EngineDebugger::is_active()) {
 		EngineDebugger::get_singleton()->iteration(frame_time, process_ticks, physics_process_ticks, physics_step);
 	}
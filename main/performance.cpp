@@ -99,6 +99,13 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_PER_FRAME);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATED_BYTES_PER_FRAME);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_VARIANT);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_STRING_NAME);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_RESOURCE);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_ALLOCATIONS_RENDERING);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -153,6 +160,13 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("memory/allocations_per_frame"),
+		PNAME("memory/allocated_bytes_per_frame"),
+		PNAME("memory/allocations_variant"),
+		PNAME("memory/allocations_string_name"),
+		PNAME("memory/allocations_resource"),
+		PNAME("memory/allocations_physics"),
+		PNAME("memory/allocations_rendering"),
 	};
 	static_assert((sizeof(names) / sizeof(const char *)) == MONITOR_MAX);
 
@@ -249,6 +263,20 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case MEMORY_ALLOCATIONS_PER_FRAME:
+			return Memory::get_frame_allocation_stats().count;
+		case MEMORY_ALLOCATED_BYTES_PER_FRAME:
+			return Memory::get_frame_allocation_stats().bytes;
+		case MEMORY_ALLOCATIONS_VARIANT:
+			return Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_VARIANT).count;
+		case MEMORY_ALLOCATIONS_STRING_NAME:
+			return Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_STRING_NAME).count;
+		case MEMORY_ALLOCATIONS_RESOURCE:
+			return Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_RESOURCE).count;
+		case MEMORY_ALLOCATIONS_PHYSICS:
+			return Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_PHYSICS).count;
+		case MEMORY_ALLOCATIONS_RENDERING:
+			return Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_RENDERING).count;
 
 		default: {
 		}
@@ -300,6 +328,13 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -108,6 +108,13 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		MEMORY_ALLOCATIONS_PER_FRAME,
+		MEMORY_ALLOCATED_BYTES_PER_FRAME,
+		MEMORY_ALLOCATIONS_VARIANT,
+		MEMORY_ALLOCATIONS_STRING_NAME,
+		MEMORY_ALLOCATIONS_RESOURCE,
+		MEMORY_ALLOCATIONS_PHYSICS,
+		MEMORY_ALLOCATIONS_RENDERING,
 		MONITOR_MAX
 	};
 
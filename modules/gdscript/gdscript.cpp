@@ -903,6 +903,7 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	reloading = false;
+	GDScriptInlineCache::invalidate_all();
 	return OK;
 }
 
@@ -1542,6 +1543,8 @@ void GDScript::clear(ClearData *p_clear_data) {
 	}
 	clearing = true;
 
+	GDScriptInlineCache::invalidate_all();
+
 	ClearData data;
 	ClearData *clear_data = p_clear_data;
 	bool is_root = false;
@@ -1617,6 +1620,7 @@ void GDScript::clear(ClearData *p_clear_data) {
 		for (GDScriptFunction *E : clear_data->functions) {
 			memdelete(E);
 		}
+		GDScriptInlineCache::invalidate_all();
 		for (Ref<Script> &E : clear_data->scripts) {
 			Ref<GDScript> gdscr = E;
 			if (gdscr.is_valid()) {
@@ -1633,6 +1637,9 @@ GDScript::~GDScript() {
 	}
 	destructing = true;
 
+	// Call sites may still be keyed on this script's address.
+	GDScriptInlineCache::invalidate_all();
+
 	if (is_print_verbose_enabled()) {
 		MutexLock lock(func_ptrs_to_update_mutex);
 		if (!func_ptrs_to_update.is_empty()) {
@@ -2132,6 +2139,7 @@ const Variant GDScriptInstance::get_rpc_config() const {
 
 void GDScriptInstance::reload_members() {
 #ifdef DEBUG_ENABLED
+	GDScriptInlineCache::invalidate_all();
 
 	Vector<Variant> new_members;
 	new_members.resize(script->member_indices.size());
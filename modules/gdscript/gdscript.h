@@ -91,6 +91,7 @@ class GDScript : public Script {
 	friend class GDScriptLambdaCallable;
 	friend class GDScriptLambdaSelfCallable;
 	friend class GDScriptLanguage;
+	friend class GDScriptInlineCache;
 	friend struct GDScriptUtilityFunctionsDefinitions;
 
 	Ref<GDScriptNativeClass> native;
@@ -364,6 +365,7 @@ class GDScriptInstance : public ScriptInstance {
 	friend class GDScriptLambdaSelfCallable;
 	friend class GDScriptCompiler;
 	friend class GDScriptCache;
+	friend class GDScriptInlineCache;
 	friend struct GDScriptUtilityFunctionsDefinitions;
 
 	ObjectID owner_id;
@@ -100,6 +100,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int max_locals = 0;
 	int current_line = 0;
 	int instr_args_max = 0;
+	int inline_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -454,6 +455,10 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 public:
+	// Whether int and float operators with known operand types get their own opcodes instead of validated operators.
+	// Only meant to be turned off to compare both when benchmarking.
+	static bool numeric_operator_opcodes_enabled;
+
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local_constant(const StringName &p_name, const Variant &p_constant) override;
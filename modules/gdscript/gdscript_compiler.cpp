@@ -2660,6 +2660,9 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 
 	parsing_classes.insert(p_script);
 
+	// Members, functions and the base script are about to change.
+	GDScriptInlineCache::invalidate_all();
+
 	p_script->clearing = true;
 
 	p_script->native = Ref<GDScriptNativeClass>();
@@ -3281,6 +3284,8 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 		return err;
 	}
 
+	GDScriptInlineCache::invalidate_all();
+
 	ScriptLambdaInfo new_lambda_info = _get_script_lambda_replacement_info(p_script);
 
 	HashMap<GDScriptFunction *, GDScriptFunction *> func_ptr_replacements;
@@ -143,6 +143,39 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+
+#define DISASSEMBLE_OPERATOR_NUMERIC(m_operator, m_type, m_op) \
+	case OPCODE_OPERATOR_##m_operator##_##m_type: {            \
+		text += "operator (";                                  \
+		text += #m_type;                                       \
+		text += ") ";                                          \
+		text += DADDR(3);                                      \
+		text += " = ";                                         \
+		text += DADDR(1);                                      \
+		text += " " #m_op " ";                                 \
+		text += DADDR(2);                                      \
+		incr += 4;                                             \
+	} break
+
+				DISASSEMBLE_OPERATOR_NUMERIC(ADD, INT, +);
+				DISASSEMBLE_OPERATOR_NUMERIC(SUBTRACT, INT, -);
+				DISASSEMBLE_OPERATOR_NUMERIC(MULTIPLY, INT, *);
+				DISASSEMBLE_OPERATOR_NUMERIC(EQUAL, INT, ==);
+				DISASSEMBLE_OPERATOR_NUMERIC(NOT_EQUAL, INT, !=);
+				DISASSEMBLE_OPERATOR_NUMERIC(LESS, INT, <);
+				DISASSEMBLE_OPERATOR_NUMERIC(LESS_EQUAL, INT, <=);
+				DISASSEMBLE_OPERATOR_NUMERIC(GREATER, INT, >);
+				DISASSEMBLE_OPERATOR_NUMERIC(GREATER_EQUAL, INT, >=);
+				DISASSEMBLE_OPERATOR_NUMERIC(ADD, FLOAT, +);
+				DISASSEMBLE_OPERATOR_NUMERIC(SUBTRACT, FLOAT, -);
+				DISASSEMBLE_OPERATOR_NUMERIC(MULTIPLY, FLOAT, *);
+				DISASSEMBLE_OPERATOR_NUMERIC(DIVIDE, FLOAT, /);
+				DISASSEMBLE_OPERATOR_NUMERIC(EQUAL, FLOAT, ==);
+				DISASSEMBLE_OPERATOR_NUMERIC(NOT_EQUAL, FLOAT, !=);
+				DISASSEMBLE_OPERATOR_NUMERIC(LESS, FLOAT, <);
+				DISASSEMBLE_OPERATOR_NUMERIC(LESS_EQUAL, FLOAT, <=);
+				DISASSEMBLE_OPERATOR_NUMERIC(GREATER, FLOAT, >);
+				DISASSEMBLE_OPERATOR_NUMERIC(GREATER_EQUAL, FLOAT, >=);
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -310,7 +343,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -331,7 +364,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -710,7 +743,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
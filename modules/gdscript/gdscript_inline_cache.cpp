@@ -0,0 +1,362 @@
+/**************************************************************************/
+/*  gdscript_inline_cache.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_inline_cache.h"
+
+#include "gdscript.h"
+
+#include "core/config/engine.h"
+#include "core/object/class_db.h"
+#include "scene/main/node.h"
+#include "scene/scene_string_names.h"
+
+SafeNumeric<uint32_t> GDScriptInlineCache::epoch;
+bool GDScriptInlineCache::enabled = true;
+
+bool GDScriptInlineCache::_get_key(Object *p_object, const StringName *&r_class, GDScriptInstance *&r_instance) {
+	ScriptInstance *si = p_object->get_script_instance();
+	if (si) {
+		if (si->is_placeholder() || si->get_language() != GDScriptLanguage::get_singleton()) {
+			return false;
+		}
+		r_instance = static_cast<GDScriptInstance *>(si);
+	} else {
+		r_instance = nullptr;
+	}
+	r_class = &p_object->get_class_name();
+	return true;
+}
+
+bool GDScriptInlineCache::_is_script_chain_valid(const GDScript *p_script) {
+	for (const GDScript *sptr = p_script; sptr; sptr = sptr->_base) {
+		if (!sptr->valid || sptr->reloading) {
+			return false;
+		}
+	}
+	return true;
+}
+
+GDScriptFunction *GDScriptInlineCache::_find_function(const GDScript *p_script, const StringName &p_name) {
+	// Same lookup order as `GDScriptInstance::callp()`.
+	for (const GDScript *sptr = p_script; sptr; sptr = sptr->_base) {
+		GDScriptFunction *const *function = sptr->member_functions.getptr(p_name);
+		if (function) {
+			return *function;
+		}
+	}
+	return nullptr;
+}
+
+void GDScriptInlineCache::_resolve_get(Entry &r_entry, const GDScriptInstance *p_instance, const StringName &p_name) {
+	// Mirrors `Object::get()`: script instance first, then the native property.
+	if (p_instance) {
+		const GDScript *script = p_instance->script.ptr();
+		const GDScript::MemberInfo *member = script->member_indices.getptr(p_name);
+		if (member) {
+			if (member->getter) {
+				r_entry.function = _find_function(script, member->getter);
+				if (r_entry.function) {
+					r_entry.kind = KIND_FUNCTION;
+				}
+			} else {
+				r_entry.kind = KIND_MEMBER;
+				r_entry.member_index = member->index;
+			}
+			return;
+		}
+
+		const StringName &get_name = GDScriptLanguage::get_singleton()->strings._get;
+		for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+			if (sptr->constants.has(p_name) || sptr->static_variables_indices.has(p_name) || sptr->_signals.has(p_name) ||
+					sptr->member_functions.has(p_name) || sptr->subclasses.has(p_name) || sptr->member_functions.has(get_name)) {
+				return;
+			}
+		}
+	}
+
+	// Mirrors `ClassDB::get_property()`.
+	const ClassDB::ClassInfo *check = ClassDB::classes.getptr(*r_entry.native_class);
+	if (!check || check->gdextension) {
+		return;
+	}
+	while (check) {
+		const ClassDB::PropertySetGet *psg = check->property_setget.getptr(p_name);
+		if (psg) {
+			if (psg->getter && psg->index < 0 && psg->_getptr) {
+				r_entry.kind = KIND_METHOD_BIND;
+				r_entry.method = psg->_getptr;
+			}
+			return;
+		}
+		if (check->constant_map.has(p_name) || check->method_map.has(p_name) || check->signal_map.has(p_name)) {
+			return;
+		}
+		check = check->inherits_ptr;
+	}
+}
+
+void GDScriptInlineCache::_resolve_set(Entry &r_entry, const GDScriptInstance *p_instance, const StringName &p_name) {
+	// Mirrors `Object::set()`: script instance first, then the native property.
+	if (p_instance) {
+		const GDScript *script = p_instance->script.ptr();
+		const GDScript::MemberInfo *member = script->member_indices.getptr(p_name);
+		if (member) {
+			if (member->setter) {
+				r_entry.function = _find_function(script, member->setter);
+				if (!r_entry.function) {
+					return;
+				}
+			}
+			r_entry.kind = r_entry.function ? KIND_FUNCTION : KIND_MEMBER;
+			r_entry.member_index = member->index;
+			r_entry.member_type = member->data_type.has_type ? &member->data_type : nullptr;
+			return;
+		}
+
+		const StringName &set_name = GDScriptLanguage::get_singleton()->strings._set;
+		for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+			if (sptr->static_variables_indices.has(p_name) || sptr->member_functions.has(set_name)) {
+				return;
+			}
+		}
+	}
+
+	// Mirrors `ClassDB::set_property()`.
+	const ClassDB::ClassInfo *check = ClassDB::classes.getptr(*r_entry.native_class);
+	if (!check || check->gdextension) {
+		return;
+	}
+	while (check) {
+		const ClassDB::PropertySetGet *psg = check->property_setget.getptr(p_name);
+		if (psg) {
+			if (psg->setter && psg->index < 0 && psg->_setptr) {
+				r_entry.kind = KIND_METHOD_BIND;
+				r_entry.method = psg->_setptr;
+			}
+			return;
+		}
+		check = check->inherits_ptr;
+	}
+}
+
+void GDScriptInlineCache::_resolve_call(Entry &r_entry, Object *p_object, const GDScriptInstance *p_instance, const StringName &p_name) {
+	// `free()` and `_ready()` have side effects in `Object::callp()` and `GDScriptInstance::callp()`.
+	if (p_name == CoreStringName(free_) || p_name == SceneStringName(_ready)) {
+		return;
+	}
+
+	// `Object::callp()` is virtual, and a few classes (scripts, Java wrappers) override it.
+	// Only cache for the class families that are known to use the base implementation.
+	if (!Object::cast_to<Node>(p_object) && (!Object::cast_to<Resource>(p_object) || Object::cast_to<Script>(p_object))) {
+		return;
+	}
+
+	if (p_instance) {
+		r_entry.function = _find_function(p_instance->script.ptr(), p_name);
+		if (r_entry.function) {
+			r_entry.kind = KIND_FUNCTION;
+			return;
+		}
+	}
+
+	const ClassDB::ClassInfo *info = ClassDB::classes.getptr(*r_entry.native_class);
+	if (!info || info->gdextension) {
+		return;
+	}
+	r_entry.method = ClassDB::get_method(*r_entry.native_class, p_name);
+	if (r_entry.method) {
+		r_entry.kind = KIND_METHOD_BIND;
+	}
+}
+
+template <typename F>
+const GDScriptInlineCache::Entry *GDScriptInlineCache::_find_or_resolve(const StringName *p_class, const GDScript *p_script, F p_resolve) {
+	uint32_t current_epoch = epoch.get();
+	if (unlikely(cache_epoch != current_epoch)) {
+		cache_epoch = current_epoch;
+		entry_count = 0;
+		megamorphic = false;
+	}
+
+	for (int i = 0; i < entry_count; i++) {
+		const Entry &entry = entries[i];
+		if (entry.native_class == p_class && entry.script == p_script) {
+			return &entry;
+		}
+	}
+
+	if (megamorphic) {
+		return nullptr;
+	}
+	if (entry_count == MAX_ENTRIES) {
+		megamorphic = true;
+		return nullptr;
+	}
+
+	Entry &entry = entries[entry_count];
+	entry = Entry();
+	entry.native_class = p_class;
+	entry.script = p_script;
+	if (!p_script || _is_script_chain_valid(p_script)) {
+		p_resolve(entry);
+	}
+	entry_count++;
+	return &entry;
+}
+
+bool GDScriptInlineCache::get_named(Object *p_object, const StringName &p_name, Variant &r_ret) {
+	const StringName *native_class;
+	GDScriptInstance *instance;
+	if (!enabled || !_get_key(p_object, native_class, instance)) {
+		return false;
+	}
+
+	const Entry *entry = _find_or_resolve(native_class, instance ? instance->script.ptr() : nullptr, [&](Entry &r_entry) {
+		_resolve_get(r_entry, instance, p_name);
+	});
+	if (!entry) {
+		return false;
+	}
+
+	switch (entry->kind) {
+		case KIND_MEMBER: {
+			if (unlikely(entry->member_index >= instance->members.size())) {
+				return false;
+			}
+			r_ret = instance->members[entry->member_index];
+			return true;
+		}
+		case KIND_FUNCTION: {
+			// On failure, the generic path calls the getter again and reports the error.
+			Callable::CallError err;
+			const Variant ret = entry->function->call(instance, nullptr, 0, err);
+			if (err.error != Callable::CallError::CALL_OK) {
+				return false;
+			}
+			r_ret = ret;
+			return true;
+		}
+		case KIND_METHOD_BIND: {
+			Callable::CallError err;
+			const Variant ret = entry->method->call(p_object, nullptr, 0, err);
+			if (err.error != Callable::CallError::CALL_OK) {
+				return false;
+			}
+			r_ret = ret;
+			return true;
+		}
+		case KIND_SLOW: {
+		} break;
+	}
+	return false;
+}
+
+bool GDScriptInlineCache::set_named(Object *p_object, const StringName &p_name, const Variant &p_value, bool &r_valid) {
+#ifdef TOOLS_ENABLED
+	// `Object::set()` also flags the object as edited, which only matters to the editor.
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+#endif
+
+	const StringName *native_class;
+	GDScriptInstance *instance;
+	if (!enabled || !_get_key(p_object, native_class, instance)) {
+		return false;
+	}
+
+	const Entry *entry = _find_or_resolve(native_class, instance ? instance->script.ptr() : nullptr, [&](Entry &r_entry) {
+		_resolve_set(r_entry, instance, p_name);
+	});
+	if (!entry) {
+		return false;
+	}
+
+	switch (entry->kind) {
+		case KIND_MEMBER:
+		case KIND_FUNCTION: {
+			// Implicit conversions are left to `GDScriptInstance::set()`.
+			if (entry->member_type && !entry->member_type->is_type(p_value)) {
+				return false;
+			}
+			if (entry->kind == KIND_FUNCTION) {
+				const Variant *args[1] = { &p_value };
+				Callable::CallError err;
+				entry->function->call(instance, args, 1, err);
+				r_valid = err.error == Callable::CallError::CALL_OK;
+				return true;
+			}
+			if (unlikely(entry->member_index >= instance->members.size())) {
+				return false;
+			}
+			instance->members.write[entry->member_index] = p_value;
+			r_valid = true;
+			return true;
+		}
+		case KIND_METHOD_BIND: {
+			const Variant *args[1] = { &p_value };
+			Callable::CallError err;
+			entry->method->call(p_object, args, 1, err);
+			r_valid = err.error == Callable::CallError::CALL_OK;
+			return true;
+		}
+		case KIND_SLOW: {
+		} break;
+	}
+	return false;
+}
+
+bool GDScriptInlineCache::call(Object *p_object, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	const StringName *native_class;
+	GDScriptInstance *instance;
+	if (!enabled || !_get_key(p_object, native_class, instance)) {
+		return false;
+	}
+
+	const Entry *entry = _find_or_resolve(native_class, instance ? instance->script.ptr() : nullptr, [&](Entry &r_entry) {
+		_resolve_call(r_entry, p_object, instance, p_name);
+	});
+	if (!entry || entry->kind == KIND_SLOW) {
+		return false;
+	}
+
+	r_error.error = Callable::CallError::CALL_OK;
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(p_object);
+#endif
+	if (entry->kind == KIND_FUNCTION) {
+		r_ret = entry->function->call(instance, p_args, p_argcount, r_error);
+	} else {
+		r_ret = entry->method->call(p_object, p_args, p_argcount, r_error);
+	}
+	return true;
+}
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*  gdscript_inline_cache.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_INLINE_CACHE_H
+#define GDSCRIPT_INLINE_CACHE_H
+
+#include "core/string/string_name.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/callable.h"
+
+class GDScript;
+class GDScriptFunction;
+class GDScriptInstance;
+class MethodBind;
+class Object;
+class GDScriptDataType;
+
+// Per call site cache used by the untyped `OPCODE_GET_NAMED`, `OPCODE_SET_NAMED` and
+// `OPCODE_CALL*` instructions. Entries are keyed on the native class and the GDScript
+// of the base object, and remember how the generic `Object` path resolved the name for
+// that pair. A site holds up to `MAX_ENTRIES` pairs before it gives up (megamorphic).
+//
+// Caches are only read and written from the main thread. Any script compilation, reload
+// or destruction bumps a global epoch, which resets every cache lazily on its next use.
+class GDScriptInlineCache {
+public:
+	enum Kind : uint8_t {
+		KIND_SLOW, // Resolved, but only the generic path gives the right result.
+		KIND_MEMBER, // Script member variable slot.
+		KIND_FUNCTION, // GDScript function (including property getters and setters).
+		KIND_METHOD_BIND, // Native method, or native property getter and setter.
+	};
+
+	static constexpr int MAX_ENTRIES = 4;
+
+	struct Entry {
+		const StringName *native_class = nullptr;
+		const GDScript *script = nullptr;
+		Kind kind = KIND_SLOW;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+	};
+
+private:
+	static SafeNumeric<uint32_t> epoch;
+
+	uint32_t cache_epoch = 0;
+	uint8_t entry_count = 0;
+	bool megamorphic = false;
+	Entry entries[MAX_ENTRIES];
+
+	static bool _get_key(Object *p_object, const StringName *&r_class, GDScriptInstance *&r_instance);
+	static bool _is_script_chain_valid(const GDScript *p_script);
+	static GDScriptFunction *_find_function(const GDScript *p_script, const StringName &p_name);
+
+	static void _resolve_get(Entry &r_entry, const GDScriptInstance *p_instance, const StringName &p_name);
+	static void _resolve_set(Entry &r_entry, const GDScriptInstance *p_instance, const StringName &p_name);
+	static void _resolve_call(Entry &r_entry, Object *p_object, const GDScriptInstance *p_instance, const StringName &p_name);
+
+	// Returns the entry for the given key, or `nullptr` once the site went megamorphic.
+	template <typename F>
+	const Entry *_find_or_resolve(const StringName *p_class, const GDScript *p_script, F p_resolve);
+
+public:
+	static bool enabled;
+
+	// Drops every cached resolution. Must be called whenever script members, functions
+	// or the script inheritance chain change.
+	static void invalidate_all() { epoch.increment(); }
+
+	// Each of these returns `false` when the site cannot serve the access, in which case
+	// the caller must take the generic path. Only call them from the main thread.
+	bool get_named(Object *p_object, const StringName &p_name, Variant &r_ret);
+	bool set_named(Object *p_object, const StringName &p_name, const Variant &p_value, bool &r_valid);
+	bool call(Object *p_object, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+};
+
+#endif // GDSCRIPT_INLINE_CACHE_H
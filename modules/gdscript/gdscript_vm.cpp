@@ -234,6 +234,25 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_ADD_INT,                       \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,                  \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,                  \
+		&&OPCODE_OPERATOR_EQUAL_INT,                     \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_LESS_INT,                      \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,                \
+		&&OPCODE_OPERATOR_GREATER_INT,                   \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                     \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,                \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,                \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,                  \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,                   \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,               \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                    \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,              \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,                 \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,           \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -818,6 +837,41 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			// Operands and target were proven by the compiler to hold the given types, so the values are read and
+			// written in place, as validated operators do, but without the call through the evaluator pointer.
+#define OPCODE_OPERATOR_NUMERIC(m_operator, m_type, m_c_type, m_get, m_result_get, m_op) \
+	OPCODE(OPCODE_OPERATOR_##m_operator##_##m_type) {                                     \
+		CHECK_SPACE(4);                                                                   \
+		GET_VARIANT_PTR(a, 0);                                                            \
+		GET_VARIANT_PTR(b, 1);                                                            \
+		GET_VARIANT_PTR(dst, 2);                                                          \
+		const m_c_type left = *VariantInternal::m_get(a);                                 \
+		const m_c_type right = *VariantInternal::m_get(b);                                \
+		*VariantInternal::m_result_get(dst) = left m_op right;                            \
+		ip += 4;                                                                          \
+	}                                                                                     \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_NUMERIC(ADD, INT, int64_t, get_int, get_int, +);
+			OPCODE_OPERATOR_NUMERIC(SUBTRACT, INT, int64_t, get_int, get_int, -);
+			OPCODE_OPERATOR_NUMERIC(MULTIPLY, INT, int64_t, get_int, get_int, *);
+			OPCODE_OPERATOR_NUMERIC(EQUAL, INT, int64_t, get_int, get_bool, ==);
+			OPCODE_OPERATOR_NUMERIC(NOT_EQUAL, INT, int64_t, get_int, get_bool, !=);
+			OPCODE_OPERATOR_NUMERIC(LESS, INT, int64_t, get_int, get_bool, <);
+			OPCODE_OPERATOR_NUMERIC(LESS_EQUAL, INT, int64_t, get_int, get_bool, <=);
+			OPCODE_OPERATOR_NUMERIC(GREATER, INT, int64_t, get_int, get_bool, >);
+			OPCODE_OPERATOR_NUMERIC(GREATER_EQUAL, INT, int64_t, get_int, get_bool, >=);
+			OPCODE_OPERATOR_NUMERIC(ADD, FLOAT, double, get_float, get_float, +);
+			OPCODE_OPERATOR_NUMERIC(SUBTRACT, FLOAT, double, get_float, get_float, -);
+			OPCODE_OPERATOR_NUMERIC(MULTIPLY, FLOAT, double, get_float, get_float, *);
+			OPCODE_OPERATOR_NUMERIC(DIVIDE, FLOAT, double, get_float, get_float, /);
+			OPCODE_OPERATOR_NUMERIC(EQUAL, FLOAT, double, get_float, get_bool, ==);
+			OPCODE_OPERATOR_NUMERIC(NOT_EQUAL, FLOAT, double, get_float, get_bool, !=);
+			OPCODE_OPERATOR_NUMERIC(LESS, FLOAT, double, get_float, get_bool, <);
+			OPCODE_OPERATOR_NUMERIC(LESS_EQUAL, FLOAT, double, get_float, get_bool, <=);
+			OPCODE_OPERATOR_NUMERIC(GREATER, FLOAT, double, get_float, get_bool, >);
+			OPCODE_OPERATOR_NUMERIC(GREATER_EQUAL, FLOAT, double, get_float, get_bool, >=);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1162,7 +1216,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1172,8 +1226,14 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				Object *cached_obj = (dst->get_type() == Variant::OBJECT && Thread::is_main_thread()) ? dst->get_validated_object() : nullptr;
+				if (!cached_obj || !_inline_caches_ptr[cache_idx].set_named(cached_obj, *index, *value, valid)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1194,7 +1254,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1214,7 +1274,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1224,22 +1284,27 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				bool valid;
+				// Read into a temporary first, so the error message below still sees `src`
+				// when it shares its stack position with `dst`.
+				Variant ret;
+				Object *cached_obj = (src->get_type() == Variant::OBJECT && Thread::is_main_thread()) ? src->get_validated_object() : nullptr;
+				if (cached_obj && _inline_caches_ptr[cache_idx].get_named(cached_obj, *index, ret)) {
+					valid = true;
+				} else {
+					ret = src->get_named(*index, valid);
+				}
 #ifdef DEBUG_ENABLED
 				if (!valid) {
 					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
 					OPCODE_BREAK;
 				}
-				*dst = ret;
 #endif
-				ip += 4;
+				*dst = ret;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1858,7 +1923,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1869,8 +1934,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				GDScriptInlineCache *inline_cache = &_inline_caches_ptr[cache_idx];
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
+				Object *cached_base = (base->get_type() == Variant::OBJECT && Thread::is_main_thread()) ? base->get_validated_object() : nullptr;
 
 #ifdef DEBUG_ENABLED
 				uint64_t call_time = 0;
@@ -1887,7 +1957,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (!cached_base || !inline_cache->call(cached_base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1917,7 +1989,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					}
 #endif
 				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					if (!cached_base || !inline_cache->call(cached_base, *methodname, (const Variant **)argptrs, argc, temp_ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 
@@ -1967,7 +2041,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -35,6 +35,9 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_byte_codegen.h"
+
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -72,6 +75,178 @@ func _init():
 	ref_counted->set_script(gdscript);
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
+
+// Typed numeric loops, in the style of procedural generation and AI scoring code.
+static const char *NUMERIC_BENCHMARK_SOURCE = R"(
+extends RefCounted
+
+func integer_loop(count: int) -> int:
+	var total := 0
+	var i := 0
+	while i < count:
+		if i * 3 > total - i:
+			total = total + i
+		else:
+			total = total - 1
+		i += 1
+	return total
+
+func float_field(size: int) -> float:
+	var sum := 0.0
+	var fy := 0.0
+	for y in size:
+		var fx := 0.0
+		for x in size:
+			var v := fx * fx - fy * fy + fx * fy * 0.5
+			if v > 1.0:
+				sum = sum + v - 1.0
+			else:
+				sum = sum - v * 0.25
+			fx = fx + 0.01
+		fy = fy + 0.01
+	return sum
+
+func best_score(count: int) -> float:
+	var best := -INF
+	var distance := 0.0
+	var health := 1.0
+	var ammo := 30.0
+	var i := 0
+	while i < count:
+		var score := health * 2.0 - distance * 0.5 + ammo / 30.0
+		if score > best:
+			best = score
+		distance = distance + 0.37
+		if distance > 50.0:
+			distance = distance - 50.0
+		health = health * 0.999 + 0.0005
+		ammo = ammo - 1.0
+		if ammo < 0.0:
+			ammo = 30.0
+		i += 1
+	return best
+)";
+
+static uint64_t run_numeric_benchmark(const StringName &p_method, int p_argument, bool p_numeric_opcodes, Variant &r_result) {
+	GDScriptByteCodeGenerator::numeric_operator_opcodes_enabled = p_numeric_opcodes;
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(NUMERIC_BENCHMARK_SOURCE);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	GDScriptByteCodeGenerator::numeric_operator_opcodes_enabled = true;
+	if (error != OK) {
+		return 0;
+	}
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	r_result = ref_counted->call(p_method, p_argument);
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+TEST_CASE_BENCHMARK("[Modules][GDScript][Benchmark] Typed numeric operators against validated operators") {
+	struct Workload {
+		const char *method;
+		int argument;
+	};
+	const Workload workloads[] = {
+		{ "integer_loop", 2000000 },
+		{ "float_field", 1000 },
+		{ "best_score", 2000000 },
+	};
+
+	for (const Workload &workload : workloads) {
+		Variant validated_result;
+		Variant numeric_result;
+		const uint64_t validated_usec = run_numeric_benchmark(workload.method, workload.argument, false, validated_result);
+		const uint64_t numeric_usec = run_numeric_benchmark(workload.method, workload.argument, true, numeric_result);
+		CHECK_MESSAGE(validated_usec > 0, "The benchmark script should compile.");
+		CHECK_MESSAGE(numeric_result == validated_result, vformat("%s should give the same result with both kinds of opcodes.", workload.method));
+		MESSAGE(vformat("%s(%d): validated operators %d usec, numeric opcodes %d usec (%.2fx).", workload.method, workload.argument, validated_usec, numeric_usec, double(validated_usec) / MAX(numeric_usec, (uint64_t)1)).utf8().get_data());
+	}
+}
+
+// Untyped property access and calls on script and native objects, like gameplay code
+// iterating over mixed entities.
+static const char *INLINE_CACHE_BENCHMARK_SOURCE = R"(
+extends RefCounted
+
+class Particle:
+	var x := 0.0
+	var speed := 1.0
+	func step(dt):
+		x += speed * dt
+		return x
+
+class FastParticle extends Particle:
+	func step(dt):
+		x += speed * dt * 2.0
+		return x
+
+class Emitter:
+	var x := 0.0
+	var speed := 0.5
+	func step(dt):
+		x -= speed * dt
+		return x
+
+func monomorphic(count: int) -> float:
+	var item = Particle.new()
+	var total = 0.0
+	for i in count:
+		item.speed = item.speed + 0.001
+		total += item.step(0.016) + item.x
+	return total
+
+func polymorphic(count: int) -> float:
+	var items = [Particle.new(), FastParticle.new(), Emitter.new()]
+	var total = 0.0
+	for i in count:
+		var item = items[i % 3]
+		item.speed = item.speed + 0.001
+		total += item.step(0.016) + item.x
+	return total
+
+func native(count: int) -> int:
+	var resource = Resource.new()
+	var total = 0
+	for i in count:
+		resource.resource_local_to_scene = (i & 1) == 0
+		if resource.resource_local_to_scene:
+			total += resource.get_path().length() + 1
+	return total
+)";
+
+TEST_CASE_BENCHMARK("[Modules][GDScript][Benchmark] Inline caches for untyped property access and calls") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(INLINE_CACHE_BENCHMARK_SOURCE);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The benchmark script should compile.");
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	const char *methods[] = { "monomorphic", "polymorphic", "native" };
+	const int count = 1000000;
+	for (const char *method : methods) {
+		uint64_t usec[2];
+		Variant results[2];
+		for (int cached = 0; cached < 2; cached++) {
+			GDScriptInlineCache::enabled = cached == 1;
+			const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			results[cached] = ref_counted->call(method, count);
+			usec[cached] = OS::get_singleton()->get_ticks_usec() - begin;
+		}
+		GDScriptInlineCache::enabled = true;
+
+		CHECK_MESSAGE(results[0] == results[1], vformat("%s should give the same result with and without inline caches.", method));
+		MESSAGE(vformat("%s(%d): generic path %d usec, inline caches %d usec (%.2fx).", method, count, usec[0], usec[1], double(usec[0]) / MAX(usec[1], (uint64_t)1)).utf8().get_data());
+	}
+}
 #endif // TOOLS_ENABLED
 
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
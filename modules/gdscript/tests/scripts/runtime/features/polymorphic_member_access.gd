@@ -0,0 +1,70 @@
+# The same untyped call site sees several receiver types in a row, so it goes
+# through every state of its inline cache (monomorphic, polymorphic, megamorphic).
+
+class Base:
+	var value := 1
+	func describe():
+		return "Base %d" % value
+
+class Derived extends Base:
+	func describe():
+		return "Derived %d" % value
+
+class WithAccessors:
+	var backing := 0
+	var value: int:
+		get:
+			return backing * 10
+		set(v):
+			backing = v + 1
+	func describe():
+		return "WithAccessors %d" % value
+
+class WithGet:
+	func _get(property):
+		if property == &"value":
+			return 42
+		return null
+	func _set(property, _v):
+		return property == &"value"
+	func describe():
+		return "WithGet"
+
+class Typed:
+	var value: float = 0.5
+	func describe():
+		return "Typed %s" % value
+
+class NodeWithScript extends Node:
+	var value := 7
+	func describe():
+		return "NodeWithScript %d" % value
+
+func read(object):
+	return object.value
+
+func write(object, v):
+	object.value = v
+
+func describe(object):
+	return object.describe()
+
+func test():
+	var node = NodeWithScript.new()
+	var objects := [Base.new(), Derived.new(), WithAccessors.new(), WithGet.new(), Typed.new(), node]
+
+	for pass_index in 3:
+		for object in objects:
+			write(object, pass_index)
+			print(describe(object), " ", read(object))
+
+	# Native properties and methods through untyped sites, with and without a script.
+	var plain = Node.new()
+	for new_name in ["first", "second"]:
+		plain.name = new_name
+		print(plain.name, " ", plain.get_name(), " ", plain.is_inside_tree())
+		node.name = new_name
+		print(node.name, " ", node.get_name(), " ", node.is_inside_tree())
+
+	plain.free()
+	node.free()
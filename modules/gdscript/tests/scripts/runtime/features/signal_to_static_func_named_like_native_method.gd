@@ -0,0 +1,17 @@
+# Static functions must be called, not the native method of the script with the same name.
+
+class InnerClass:
+	static func duplicate():
+		print("InnerClass.duplicate")
+
+	static func reload(value):
+		print("InnerClass.reload ", value)
+
+signal no_arguments()
+signal one_argument(value)
+
+func test():
+	no_arguments.connect(InnerClass.duplicate)
+	one_argument.connect(InnerClass.reload)
+	no_arguments.emit()
+	one_argument.emit(true)
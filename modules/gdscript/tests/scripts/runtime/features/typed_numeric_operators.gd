@@ -0,0 +1,37 @@
+# Typed int and float operands use dedicated operator opcodes, which must behave like the generic ones.
+
+func sum_to(n: int) -> int:
+	var total := 0
+	var i := 0
+	while i < n:
+		total = total + i * 2 - 1
+		i += 1
+	return total
+
+func test():
+	var a := 7
+	var b := -3
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+	print(a <= 7, " ", a >= 7, " ", a == 7)
+
+	var x := 1.5
+	var y := -0.25
+	print(x + y, " ", x - y, " ", x * y, " ", x / y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+	print(x / 0.0, " ", -x / 0.0)
+	var not_a_number := 0.0 / 0.0
+	print(not_a_number == not_a_number, " ", not_a_number != not_a_number, " ", not_a_number < x, " ", not_a_number >= x)
+
+	# Results stored into untyped variables.
+	var untyped = a * a
+	print(untyped, " ", typeof(untyped) == TYPE_INT)
+	var comparison = x > y
+	print(comparison, " ", typeof(comparison) == TYPE_BOOL)
+
+	# Operands aliasing the target.
+	a = a + a
+	x = x * x
+	print(a, " ", x)
+
+	print(sum_to(10))
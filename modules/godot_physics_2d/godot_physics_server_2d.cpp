@@ -1294,6 +1294,8 @@ void GodotPhysicsServer2D::step(real_t p_step) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_PHYSICS);
+
 	_update_shapes();
 
 	island_count = 0;
@@ -1316,6 +1318,8 @@ void GodotPhysicsServer2D::flush_queries() {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_PHYSICS);
+
 	flushing_queries = true;
 
 	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
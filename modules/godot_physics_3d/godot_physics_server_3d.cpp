@@ -1635,6 +1635,8 @@ void GodotPhysicsServer3D::step(real_t p_step) {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_PHYSICS);
+
 	_update_shapes();
 
 	island_count = 0;
@@ -1657,6 +1659,8 @@ void GodotPhysicsServer3D::flush_queries() {
 		return;
 	}
 
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_PHYSICS);
+
 	flushing_queries = true;
 
 	uint64_t time_beg = OS::get_singleton()->get_ticks_usec();
@@ -110,11 +110,22 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	for (Node3D *&E : data.children) {
-		if (E->data.top_level) {
-			continue; //don't propagate to a top_level
+	// Moving the same node several times before notifications are flushed (or before anything below it reads its
+	// global transform back) would walk the whole subtree every time, so remember when the walk has been done.
+	// Threads don't keep this up to date, see _invalidate_propagated_parents().
+	bool track_propagation = !is_group_processing() && is_accessible_from_caller_thread();
+	uint64_t version = track_propagation ? get_tree()->xform_change_version.get() : 0;
+
+	if (!track_propagation || data.propagated_version != version) {
+		for (Node3D *&E : data.children) {
+			if (E->data.top_level) {
+				continue; //don't propagate to a top_level
+			}
+			E->_propagate_transform_changed(p_origin);
+		}
+		if (track_propagation) {
+			data.propagated_version = version;
 		}
-		E->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
 	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
@@ -131,6 +142,28 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
 }
 
+void Node3D::_invalidate_propagated_parents() const {
+	// Called when this node stops being dirty, or may need a notification it was not queued for.
+	// Parents that recorded their children as fully propagated can no longer skip the walk.
+	if (!is_inside_tree() || is_group_processing()) {
+		return; // Group processing drops all records once done.
+	}
+	if (unlikely(!is_readable_from_caller_thread())) {
+		get_tree()->xform_change_version.increment();
+		return;
+	}
+
+	uint64_t version = get_tree()->xform_change_version.get();
+	const Node3D *node = this;
+	while (node->data.parent && !node->data.top_level) {
+		node = node->data.parent;
+		if (node->data.propagated_version != version) {
+			break; // Nothing above was recorded either.
+		}
+		node->data.propagated_version = 0;
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -161,6 +194,8 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			data.propagated_version = 0;
+			_invalidate_propagated_parents();
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -491,6 +526,7 @@ Transform3D Node3D::get_global_transform() const {
 
 		data.global_transform = new_global;
 		_clear_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+		_invalidate_propagated_parents();
 	}
 
 	return data.global_transform;
@@ -734,6 +770,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_propagated_parents();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -1089,6 +1126,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	if (p_enabled) {
+		_invalidate_propagated_parents();
+	}
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -1113,6 +1153,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	get_tree()->xform_change_version.increment(); // Parents must walk down to this node again on their next move.
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
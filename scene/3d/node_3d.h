@@ -109,6 +109,11 @@ private:
 
 		mutable MTNumeric<uint32_t> dirty;
 
+		// Value of SceneTree::xform_change_version when every child of this node was last left with a dirty global
+		// transform, queued for NOTIFICATION_TRANSFORM_CHANGED and itself propagated. While it matches, moving this
+		// node again has nothing left to do below it.
+		mutable uint64_t propagated_version = 0;
+
 		Viewport *viewport = nullptr;
 
 		bool top_level : 1;
@@ -153,6 +158,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_propagated_parents() const;
 
 	void _propagate_visibility_changed();
 
@@ -161,7 +167,12 @@ private:
 	void _propagate_transform_changed_deferred();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		data.ignore_notification = p_ignore;
+		if (!p_ignore) {
+			_invalidate_propagated_parents();
+		}
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
@@ -383,6 +383,7 @@ void Skeleton3D::_notification(int p_what) {
 					E->bind_count = bind_count;
 					E->skin_bone_indices.resize(bind_count);
 					E->skin_bone_indices_ptrs = E->skin_bone_indices.ptrw();
+					E->bone_buffer.resize_zeroed(bind_count * 12);
 				}
 
 				if (E->skeleton_version != version) {
@@ -421,11 +422,27 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				// Fill the whole buffer and upload it at once, instead of queuing one call per bone.
+				float *buffer = E->bone_buffer.ptrw();
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
 					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					Transform3D transform = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
+					float *dataptr = buffer + i * 12;
+					dataptr[0] = transform.basis.rows[0][0];
+					dataptr[1] = transform.basis.rows[0][1];
+					dataptr[2] = transform.basis.rows[0][2];
+					dataptr[3] = transform.origin.x;
+					dataptr[4] = transform.basis.rows[1][0];
+					dataptr[5] = transform.basis.rows[1][1];
+					dataptr[6] = transform.basis.rows[1][2];
+					dataptr[7] = transform.origin.y;
+					dataptr[8] = transform.basis.rows[2][0];
+					dataptr[9] = transform.basis.rows[2][1];
+					dataptr[10] = transform.basis.rows[2][2];
+					dataptr[11] = transform.origin.z;
 				}
+				rs->skeleton_set_buffer(skeleton, E->bone_buffer);
 			}
 
 			if (!modifiers.is_empty()) {
@@ -52,6 +52,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	Vector<float> bone_buffer; // Uploaded in one call, see RenderingServer::skeleton_set_buffer().
 
 protected:
 	static void _bind_methods();
@@ -578,6 +578,7 @@ void AnimationMixer::_clear_caches() {
 	}
 	track_cache.clear();
 	animation_track_num_to_track_cache.clear();
+	animation_track_num_to_key_cursor.clear();
 	cache_valid = false;
 	capture_cache.clear();
 
@@ -967,6 +968,7 @@ bool AnimationMixer::_update_caches() {
 	}
 
 	animation_track_num_to_track_cache.clear();
+	animation_track_num_to_key_cursor.clear();
 	for (const StringName &E : sname_list) {
 		Ref<Animation> anim = get_animation(E);
 		_create_track_num_to_track_cache_for_animation(anim);
@@ -1104,6 +1106,7 @@ void AnimationMixer::blend_capture(double p_delta) {
 	if (Animation::is_less_or_equal_approx(capture_cache.remain, 0)) {
 		if (capture_cache.animation.is_valid()) {
 			animation_track_num_to_track_cache.erase(capture_cache.animation);
+			animation_track_num_to_key_cursor.erase(capture_cache.animation);
 		}
 		capture_cache.clear();
 		return;
@@ -1193,6 +1196,11 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		real_t a_length = a->get_length();
 		int count = tracks.size();
+		// Sampling times mostly advance a little each frame, so remember where each track's keys were found.
+		LocalVector<Animation::KeyCursor> &key_cursors = animation_track_num_to_key_cursor[a];
+		if (key_cursors.size() != (uint32_t)count) {
+			key_cursors.resize(count);
+		}
 		for (int i = 0; i < count; i++) {
 			const Animation::Track *animation_track = tracks_ptr[i];
 			if (!animation_track->enabled) {
@@ -1350,7 +1358,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = a->try_position_track_interpolate(i, time, &loc, false, &key_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1438,7 +1446,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = a->try_rotation_track_interpolate(i, time, &rot, false, &key_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1526,7 +1534,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = a->try_scale_track_interpolate(i, time, &scale, false, &key_cursors[i]);
 						if (err != OK) {
 							continue;
 						}
@@ -1542,7 +1550,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = a->try_blend_shape_track_interpolate(i, time, &value, false, &key_cursors[i]);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -2303,6 +2311,7 @@ void AnimationMixer::capture(const StringName &p_name, double p_duration, Tween:
 	capture_cache.ease_type = p_ease_type;
 	if (capture_cache.animation.is_valid()) {
 		animation_track_num_to_track_cache.erase(capture_cache.animation);
+		animation_track_num_to_key_cursor.erase(capture_cache.animation);
 	}
 	capture_cache.animation.instantiate();
 
@@ -314,6 +314,7 @@ protected:
 	RootMotionCache root_motion_cache;
 	AHashMap<Animation::TypeHash, TrackCache *, HashHasher> track_cache;
 	AHashMap<Ref<Animation>, LocalVector<TrackCache *>> animation_track_num_to_track_cache;
+	AHashMap<Ref<Animation>, LocalVector<Animation::KeyCursor>> animation_track_num_to_key_cursor;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
 
@@ -165,10 +165,12 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 		E = group_map.insert(p_group, Group());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	E->value.changed = true;
-	return &E->value;
+	Group &g = E->value;
+	ERR_FAIL_COND_V_MSG(g.node_slots.has(p_node), &g, "Already in group: " + p_group + ".");
+	g.node_slots.insert(p_node, g.nodes.size());
+	g.nodes.push_back(p_node);
+	g.changed = true;
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
@@ -177,9 +179,18 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Group &g = E->value;
+	const uint32_t *slot = g.node_slots.getptr(p_node);
+	if (slot) {
+		g.nodes.write[*slot] = nullptr;
+		g.node_slots.erase(p_node);
+		g.removed_count++;
+	}
+	if (g.node_slots.is_empty()) {
 		group_map.remove(E);
+	} else if (g.removed_count > g.node_slots.size()) {
+		// Don't let groups that are only ever added to and removed from grow without bound.
+		_compact_group(g);
 	}
 }
 
@@ -199,6 +210,7 @@ void SceneTree::flush_transform_notifications() {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
 		xform_change_list.remove(n);
+		xform_change_version.increment();
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
@@ -224,7 +236,28 @@ void SceneTree::_flush_ugc() {
 	ugc_locked = false;
 }
 
+void SceneTree::_compact_group(Group &g) {
+	Node **gr_nodes = g.nodes.ptrw();
+	uint32_t gr_node_count = g.nodes.size();
+	uint32_t to = 0;
+	for (uint32_t from = 0; from < gr_node_count; from++) {
+		if (!gr_nodes[from]) {
+			continue;
+		}
+		if (to != from) {
+			gr_nodes[to] = gr_nodes[from];
+			g.node_slots[gr_nodes[to]] = to;
+		}
+		to++;
+	}
+	g.nodes.resize(to);
+	g.removed_count = 0;
+}
+
 void SceneTree::_update_group_order(Group &g) {
+	if (g.removed_count) {
+		_compact_group(g);
+	}
 	if (!g.changed) {
 		return;
 	}
@@ -238,6 +271,10 @@ void SceneTree::_update_group_order(Group &g) {
 	SortArray<Node *, Node::Comparator> node_sort;
 	node_sort.sort(gr_nodes, gr_node_count);
 
+	for (int i = 0; i < gr_node_count; i++) {
+		g.node_slots[gr_nodes[i]] = i;
+	}
+
 	g.changed = false;
 }
 
@@ -334,6 +371,106 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 	}
 }
 
+void SceneTree::call_group_parallelp(const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	ERR_FAIL_COND_MSG(Node::is_group_processing() || !is_current_thread_safe_for_nodes(), "call_group_parallel() can only be used from the main thread, outside of threaded processing.");
+
+	Vector<Node *> nodes_copy;
+	{
+		_THREAD_SAFE_METHOD_
+
+		HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+		if (!E) {
+			return;
+		}
+		Group &g = E->value;
+		if (g.nodes.is_empty()) {
+			return;
+		}
+
+		_update_group_order(g);
+		nodes_copy = g.nodes;
+	}
+
+	// Nodes of the same sub-thread process group are called one after the other on the same
+	// thread, with the same access rights they get when processing. Everything else is called
+	// on this thread afterwards, like call_group() does.
+	GroupParallelCall call;
+	call.function = p_function;
+	call.args = p_args;
+	call.argcount = p_argcount;
+
+	LocalVector<Node *> main_thread_nodes;
+	HashMap<Node *, uint32_t> batch_of_owner;
+
+	for (Node *node : nodes_copy) {
+		Node *owner = node->data.process_thread_group_owner;
+		if (!owner || owner->data.process_thread_group != Node::PROCESS_THREAD_GROUP_SUB_THREAD || node_threading_disabled) {
+			main_thread_nodes.push_back(node);
+			continue;
+		}
+
+		HashMap<Node *, uint32_t>::Iterator B = batch_of_owner.find(owner);
+		if (!B) {
+			B = batch_of_owner.insert(owner, call.batches.size());
+			call.batches.resize(call.batches.size() + 1);
+			call.batches[B->value].owner = owner;
+		}
+		call.batches[B->value].nodes.push_back(node->get_instance_id());
+	}
+
+	{
+		_THREAD_SAFE_METHOD_
+		nodes_removed_on_group_call_lock++;
+	}
+
+	if (call.batches.size()) {
+		WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_call_group_parallel_thread, &call, call.batches.size(), -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+		xform_change_version.increment(); // See _process().
+	}
+
+	for (Node *node : main_thread_nodes) {
+		if (nodes_removed_on_group_call.has(node)) {
+			continue;
+		}
+
+		Callable::CallError ce;
+		node->callp(p_function, p_args, p_argcount, ce);
+		if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
+			ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
+		}
+	}
+
+	{
+		_THREAD_SAFE_METHOD_
+		nodes_removed_on_group_call_lock--;
+		if (nodes_removed_on_group_call_lock == 0) {
+			nodes_removed_on_group_call.clear();
+		}
+	}
+}
+
+void SceneTree::_call_group_parallel_thread(uint32_t p_index, GroupParallelCall *p_call) {
+	GroupParallelCall::Batch &batch = p_call->batches[p_index];
+	Node::current_process_thread_group = batch.owner;
+
+	for (const ObjectID &id : batch.nodes) {
+		// An earlier call in this batch may have freed the node.
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (!node || !node->is_inside_tree()) {
+			continue;
+		}
+
+		Callable::CallError ce;
+		node->callp(p_call->function, p_call->args, p_call->argcount, ce);
+		if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
+			ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_call->function), p_call->args, p_call->argcount, ce)));
+		}
+	}
+
+	Node::current_process_thread_group = nullptr;
+}
+
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
 	Vector<Node *> nodes_copy;
 	{
@@ -1149,6 +1286,8 @@ void SceneTree::_process(bool p_physics) {
 				if (using_threads) {
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					// Threads don't keep Node3D propagation bookkeeping up to date, so drop all of it at once.
+					xform_change_version.increment();
 				}
 			}
 
@@ -1375,6 +1514,19 @@ void SceneTree::_call_group_flags(const Variant **p_args, int p_argcount, Callab
 	call_group_flagsp(flags, group, method, p_args + 3, p_argcount - 3);
 }
 
+void SceneTree::_call_group_parallel(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
+	r_error.error = Callable::CallError::CALL_OK;
+
+	ERR_FAIL_COND(p_argcount < 2);
+	ERR_FAIL_COND(!p_args[0]->is_string());
+	ERR_FAIL_COND(!p_args[1]->is_string());
+
+	StringName group = *p_args[0];
+	StringName method = *p_args[1];
+
+	call_group_parallelp(group, method, p_args + 2, p_argcount - 2);
+}
+
 void SceneTree::_call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error) {
 	r_error.error = Callable::CallError::CALL_OK;
 
@@ -1428,7 +1580,7 @@ int SceneTree::get_node_count_in_group(const StringName &p_group) const {
 		return 0;
 	}
 
-	return E->value.nodes.size();
+	return E->value.node_slots.size();
 }
 
 Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
@@ -1755,6 +1907,13 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "call_group", &SceneTree::_call_group, mi2);
 
+	MethodInfo mi3;
+	mi3.name = "call_group_parallel";
+	mi3.arguments.push_back(PropertyInfo(Variant::STRING_NAME, "group"));
+	mi3.arguments.push_back(PropertyInfo(Variant::STRING_NAME, "method"));
+
+	ClassDB::bind_vararg_method(METHOD_FLAGS_DEFAULT, "call_group_parallel", &SceneTree::_call_group_parallel, mi3);
+
 	ClassDB::bind_method(D_METHOD("notify_group", "group", "notification"), &SceneTree::notify_group);
 	ClassDB::bind_method(D_METHOD("set_group", "group", "property", "value"), &SceneTree::set_group);
 
@@ -1825,7 +1984,7 @@ void SceneTree::get_argument_options(const StringName &p_function, int p_idx, Li
 	const String pf = p_function;
 	bool add_options = false;
 	if (p_idx == 0) {
-		add_options = pf == "get_nodes_in_group" || pf == "has_group" || pf == "get_first_node_in_group" || pf == "set_group" || pf == "notify_group" || pf == "call_group" || pf == "add_to_group";
+		add_options = pf == "get_nodes_in_group" || pf == "has_group" || pf == "get_first_node_in_group" || pf == "set_group" || pf == "notify_group" || pf == "call_group" || pf == "call_group_parallel" || pf == "add_to_group";
 	} else if (p_idx == 1) {
 		add_options = pf == "set_group_flags" || pf == "call_group_flags" || pf == "notify_group_flags";
 	}
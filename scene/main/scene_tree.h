@@ -35,7 +35,9 @@
 
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/a_hash_map.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "scene/resources/mesh.h"
 
@@ -121,10 +123,26 @@ private:
 	bool node_threading_disabled = false;
 
 	struct Group {
+		// Removing a node only clears its slot, so the remaining nodes keep their order without
+		// anything being shifted or sorted. _update_group_order() closes the gaps before use.
 		Vector<Node *> nodes;
+		AHashMap<Node *, uint32_t> node_slots;
+		uint32_t removed_count = 0;
 		bool changed = false;
 	};
 
+	struct GroupParallelCall {
+		struct Batch {
+			Node *owner = nullptr;
+			LocalVector<ObjectID> nodes;
+		};
+
+		LocalVector<Batch> batches;
+		StringName function;
+		const Variant **args = nullptr;
+		int argcount = 0;
+	};
+
 #ifndef _3D_DISABLED
 	struct ClientPhysicsInterpolation {
 		SelfList<Node3D>::List _node_3d_list;
@@ -185,6 +203,7 @@ private:
 	bool ugc_locked = false;
 	void _flush_ugc();
 
+	void _compact_group(Group &g);
 	_FORCE_INLINE_ void _update_group_order(Group &g);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
@@ -229,6 +248,7 @@ private:
 
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _call_group_parallel_thread(uint32_t p_index, GroupParallelCall *p_call);
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -238,6 +258,7 @@ private:
 
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	void _call_group_parallel(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	void _flush_delete_queue();
 	// Optimization.
@@ -246,6 +267,8 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Bumped every time a node leaves xform_change_list, so Node3D can tell whether a subtree it queued earlier is still queued.
+	SafeNumeric<uint64_t> xform_change_version{ 1 };
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -293,6 +316,7 @@ public:
 	_FORCE_INLINE_ Window *get_root() const { return root; }
 
 	void call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount);
+	void call_group_parallelp(const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount);
 	void notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification);
 	void set_group_flags(uint32_t p_call_flags, const StringName &p_group, const String &p_name, const Variant &p_value);
 
@@ -322,6 +346,16 @@ public:
 		call_group_flagsp(p_flags, p_group, p_function, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
 	}
 
+	template <typename... VarArgs>
+	void call_group_parallel(const StringName &p_group, const StringName &p_function, VarArgs... p_args) {
+		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+		const Variant *argptrs[sizeof...(p_args) + 1];
+		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+			argptrs[i] = &args[i];
+		}
+		call_group_parallelp(p_group, p_function, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+	}
+
 	void flush_transform_notifications();
 
 	virtual void initialize() override;
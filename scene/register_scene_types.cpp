@@ -976,6 +976,7 @@ void register_scene_types() {
 	GDREGISTER_CLASS(Texture3DRD);
 
 	GDREGISTER_CLASS(Animation);
+	Animation::init_decoded_page_cache();
 	GDREGISTER_CLASS(AnimationLibrary);
 
 	GDREGISTER_ABSTRACT_CLASS(Font);
@@ -1322,6 +1323,7 @@ void unregister_scene_types() {
 	CanvasItemMaterial::finish_shaders();
 	ColorPicker::finish_shaders();
 	GraphEdit::finish_shaders();
+	Animation::finish_decoded_page_cache();
 	SceneStringNames::free();
 
 	OS::get_singleton()->benchmark_end_measure("Scene", "Unregister Types");
@@ -33,8 +33,15 @@
 #include "animation.h"
 #include "animation.compat.inc"
 
+#include "core/config/project_settings.h"
 #include "core/io/marshalls.h"
 
+Mutex Animation::decoded_page_cache_mutex;
+Animation::DecodedPageCache *Animation::decoded_page_cache = nullptr;
+SafeNumeric<uint64_t> Animation::compression_id_counter;
+LocalVector<Animation::RecentDecodedPages *> Animation::recent_decoded_pages;
+thread_local Animation::RecentDecodedPages Animation::thread_recent_decoded_pages;
+
 bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 	String prop_name = p_name;
 
@@ -63,6 +70,8 @@ bool Animation::_set(const StringName &p_name, const Variant &p_value) {
 			compression.pages[i].time_offset = page["time_offset"];
 		}
 		compression.enabled = true;
+		_drop_decoded_pages();
+		compression.id = compression_id_counter.increment();
 		return true;
 	} else if (prop_name == SNAME("markers")) {
 		Array markers = p_value;
@@ -1185,7 +1194,7 @@ Error Animation::position_track_get_key(int p_track, int p_key, Vector3 *r_posit
 	return OK;
 }
 
-Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+Error Animation::try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_POSITION_3D, ERR_INVALID_PARAMETER);
@@ -1202,7 +1211,7 @@ Error Animation::try_position_track_interpolate(int p_track, double p_time, Vect
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, p_backward);
+	Vector3 tk = _interpolate(tt->positions, p_time, tt->interpolation, tt->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1265,7 +1274,7 @@ Error Animation::rotation_track_get_key(int p_track, int p_key, Quaternion *r_ro
 	return OK;
 }
 
-Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward) const {
+Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_ROTATION_3D, ERR_INVALID_PARAMETER);
@@ -1282,7 +1291,7 @@ Error Animation::try_rotation_track_interpolate(int p_track, double p_time, Quat
 
 	bool ok = false;
 
-	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, p_backward);
+	Quaternion tk = _interpolate(rt->rotations, p_time, rt->interpolation, rt->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1345,7 +1354,7 @@ Error Animation::scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) c
 	return OK;
 }
 
-Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward) const {
+Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_SCALE_3D, ERR_INVALID_PARAMETER);
@@ -1362,7 +1371,7 @@ Error Animation::try_scale_track_interpolate(int p_track, double p_time, Vector3
 
 	bool ok = false;
 
-	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, p_backward);
+	Vector3 tk = _interpolate(st->scales, p_time, st->interpolation, st->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -1425,7 +1434,7 @@ Error Animation::blend_shape_track_get_key(int p_track, int p_key, float *r_blen
 	return OK;
 }
 
-Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward) const {
+Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, float *r_interpolation, bool p_backward, KeyCursor *r_cursor) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), ERR_INVALID_PARAMETER);
 	Track *t = tracks[p_track];
 	ERR_FAIL_COND_V(t->type != TYPE_BLEND_SHAPE, ERR_INVALID_PARAMETER);
@@ -1442,7 +1451,7 @@ Error Animation::try_blend_shape_track_interpolate(int p_track, double p_time, f
 
 	bool ok = false;
 
-	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, p_backward);
+	float tk = _interpolate(bst->blend_shapes, p_time, bst->interpolation, bst->loop_wrap, &ok, p_backward, r_cursor);
 
 	if (!ok) {
 		return ERR_UNAVAILABLE;
@@ -2452,6 +2461,30 @@ int Animation::_find(const Vector<K> &p_keys, double p_time, bool p_backward, bo
 	return middle;
 }
 
+template <typename K>
+int Animation::_find_with_hint(const Vector<K> &p_keys, double p_time, bool p_backward, int &r_hint) const {
+	int len = p_keys.size();
+	if (len > 0) {
+		const K *keys = p_keys.ptr();
+		// Playback mostly stays between the same two keys, or moves on to the next pair.
+		// When the time is strictly between them, the binary search would land there too.
+		for (int hint = MAX(r_hint, -1); hint <= r_hint + 1 && hint < len; hint++) {
+			if (hint >= 0 && (keys[hint].time >= p_time || Math::is_equal_approx(p_time, (double)keys[hint].time))) {
+				continue;
+			}
+			if (hint + 1 < len && (keys[hint + 1].time <= p_time || Math::is_equal_approx(p_time, (double)keys[hint + 1].time))) {
+				continue;
+			}
+			r_hint = hint;
+			return p_backward ? hint + 1 : hint;
+		}
+	}
+
+	int idx = _find(p_keys, p_time, p_backward);
+	r_hint = p_backward ? idx - 1 : idx;
+	return idx;
+}
+
 // Linear interpolation for anytype.
 
 Vector3 Animation::_interpolate(const Vector3 &p_a, const Vector3 &p_b, real_t p_c) const {
@@ -2521,8 +2554,8 @@ Variant Animation::_cubic_interpolate_angle_in_time(const Variant &p_pre_a, cons
 }
 
 template <typename T>
-T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward) const {
-	int len = _find(p_keys, length) + 1; // try to find last key (there may be more past the end)
+T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward, KeyCursor *r_cursor) const {
+	int len = (r_cursor ? _find_with_hint(p_keys, length, false, r_cursor->end) : _find(p_keys, length)) + 1; // try to find last key (there may be more past the end)
 
 	if (len <= 0) {
 		// (-1 or -2 returned originally) (plus one above)
@@ -2539,7 +2572,7 @@ T Animation::_interpolate(const Vector<TKey<T>> &p_keys, double p_time, Interpol
 		return p_keys[0].value;
 	}
 
-	int idx = _find(p_keys, p_time, p_backward);
+	int idx = r_cursor ? _find_with_hint(p_keys, p_time, p_backward, r_cursor->key) : _find(p_keys, p_time, p_backward);
 
 	ERR_FAIL_COND_V(idx == -2, T());
 	int maxi = len - 1;
@@ -4098,6 +4131,7 @@ void Animation::clear() {
 	tracks.clear();
 	loop_mode = LOOP_NONE;
 	length = 1;
+	_drop_decoded_pages();
 	compression.enabled = false;
 	compression.bounds.clear();
 	compression.pages.clear();
@@ -5154,6 +5188,8 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 	compression.bounds = track_bounds;
 	compression.fps = p_fps;
 	compression.enabled = true;
+	_drop_decoded_pages();
+	compression.id = compression_id_counter.increment();
 
 	for (uint32_t i = 0; i < tracks_to_compress.size(); i++) {
 		Track *t = tracks[tracks_to_compress[i]];
@@ -5218,7 +5254,7 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed_decoded<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
 		return false; //some sort of problem
 	}
 
@@ -5242,7 +5278,7 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed_decoded<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
 		return false; //some sort of problem
 	}
 
@@ -5265,7 +5301,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed_decoded<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
 		return false; //some sort of problem
 	}
 
@@ -5429,6 +5465,250 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	return true;
 }
 
+template <uint32_t COMPONENTS>
+Vector<Animation::DecodedKey> Animation::_decode_compressed_page(uint32_t p_compressed_track, uint32_t p_page) const {
+	Vector<DecodedKey> keys;
+
+	double frame_to_sec = 1.0 / double(compression.fps);
+	double page_base_time = compression.pages[p_page].time_offset;
+	const uint8_t *page_data = compression.pages[p_page].data.ptr();
+	// Little endian assumed, same as _fetch_compressed().
+	const uint32_t *indices = (const uint32_t *)page_data;
+	const uint16_t *time_keys = (const uint16_t *)&page_data[indices[p_compressed_track * 3 + 0]];
+	uint32_t time_key_count = indices[p_compressed_track * 3 + 1];
+	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
+
+	uint32_t key_count = 0;
+	for (uint32_t i = 0; i < time_key_count; i++) {
+		key_count += (time_keys[i * 2 + 1] >> 12) + 1;
+	}
+	keys.resize(key_count);
+	DecodedKey *keys_ptr = keys.ptrw();
+
+	uint32_t key_index = 0;
+	for (uint32_t i = 0; i < time_key_count; i++) {
+		uint32_t frame = time_keys[i * 2 + 0];
+		uint16_t time_key_data = time_keys[i * 2 + 1];
+		uint32_t data_offset = (time_key_data & 0xFFF) * 4; // lower 12 bits
+		uint32_t data_count = (time_key_data >> 12) + 1;
+
+		const uint16_t *data_key = (const uint16_t *)(data_keys_base + data_offset);
+
+		uint16_t decode[COMPONENTS];
+		for (uint32_t j = 0; j < COMPONENTS; j++) {
+			decode[j] = data_key[j];
+		}
+
+		DecodedKey &first = keys_ptr[key_index++];
+		first.time = double(frame) * frame_to_sec + page_base_time;
+		first.time_key_start = true;
+		for (uint32_t j = 0; j < COMPONENTS; j++) {
+			first.value[j] = decode[j];
+		}
+
+		if (data_count > 1) {
+			uint32_t bit_width[COMPONENTS];
+			for (uint32_t j = 0; j < COMPONENTS; j++) {
+				bit_width[j] = (data_key[COMPONENTS] >> (j * 4)) & 0xF;
+			}
+
+			uint32_t frame_bit_width = (data_key[COMPONENTS] >> 12) + 1;
+
+			AnimationCompressionBufferBitsRead buffer;
+
+			buffer.src_data = (const uint8_t *)&data_key[COMPONENTS + 1];
+
+			for (uint32_t k = 1; k < data_count; k++) {
+				frame += buffer.read(frame_bit_width);
+
+				for (uint32_t j = 0; j < COMPONENTS; j++) {
+					if (bit_width[j] == 0) {
+						continue; // do none
+					}
+					uint32_t valueu = buffer.read(bit_width[j] + 1);
+					bool sign = valueu & (1 << bit_width[j]);
+					int16_t value = valueu & ((1 << bit_width[j]) - 1);
+					if (sign) {
+						value = -value - 1;
+					}
+
+					decode[j] += value;
+				}
+
+				DecodedKey &key = keys_ptr[key_index++];
+				key.time = double(frame) * frame_to_sec + page_base_time;
+				for (uint32_t j = 0; j < COMPONENTS; j++) {
+					key.value[j] = decode[j];
+				}
+			}
+		}
+	}
+
+	return keys;
+}
+
+template <uint32_t COMPONENTS>
+Vector<Animation::DecodedKey> Animation::_get_decoded_page(uint32_t p_compressed_track, uint32_t p_page) const {
+	DecodedPageKey page_key;
+	page_key.compression_id = compression.id;
+	page_key.page = p_page;
+	page_key.track = p_compressed_track;
+
+	// Holding a copy keeps the keys alive even if the shared cache drops them meanwhile.
+	RecentDecodedPages &recent_pages = thread_recent_decoded_pages;
+	RecentDecodedPages::Page &recent = recent_pages.pages[page_key.hash() & (RecentDecodedPages::SIZE - 1)];
+	recent_pages.lock.lock();
+	if (recent.key == page_key) {
+		Vector<DecodedKey> keys = recent.keys;
+		recent_pages.lock.unlock();
+		return keys;
+	}
+	recent_pages.lock.unlock();
+
+	Vector<DecodedKey> keys;
+	{
+		MutexLock lock(decoded_page_cache_mutex);
+		if (decoded_page_cache) {
+			const Vector<DecodedKey> *cached = decoded_page_cache->getptr(page_key);
+			if (cached) {
+				keys = *cached;
+			}
+		}
+	}
+
+	if (keys.is_empty()) {
+		keys = _decode_compressed_page<COMPONENTS>(p_compressed_track, p_page);
+		MutexLock lock(decoded_page_cache_mutex);
+		if (decoded_page_cache) {
+			decoded_page_cache->insert(page_key, keys);
+			decoded_page_end = MAX(decoded_page_end, p_page + 1);
+			decoded_track_end = MAX(decoded_track_end, p_compressed_track + 1);
+		}
+	}
+
+	recent_pages.lock.lock();
+	recent.key = page_key;
+	recent.keys = keys;
+	recent_pages.lock.unlock();
+	return keys;
+}
+
+template <uint32_t COMPONENTS>
+bool Animation::_fetch_compressed_decoded(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time) const {
+	ERR_FAIL_COND_V(!compression.enabled, false);
+	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
+	p_time = CLAMP(p_time, 0, length);
+
+	// Last page starting at or before the time.
+	int32_t low = 0;
+	int32_t high = int32_t(compression.pages.size()) - 1;
+	int32_t page_index = -1;
+	while (low <= high) {
+		int32_t middle = (low + high) / 2;
+		if (compression.pages[middle].time_offset > p_time) {
+			high = middle - 1;
+		} else {
+			page_index = middle;
+			low = middle + 1;
+		}
+	}
+
+	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+
+	const Vector<DecodedKey> keys = _get_decoded_page<COMPONENTS>(p_compressed_track, page_index);
+	const DecodedKey *keys_ptr = keys.ptr();
+	int32_t key_count = keys.size();
+	ERR_FAIL_COND_V(key_count == 0, false);
+
+	// Last key at or before the time.
+	low = 0;
+	high = key_count - 1;
+	int32_t current = 0;
+	while (low <= high) {
+		int32_t middle = (low + high) / 2;
+		if (keys_ptr[middle].time > p_time) {
+			high = middle - 1;
+		} else {
+			current = middle;
+			low = middle + 1;
+		}
+	}
+
+	int32_t next = current;
+	if (keys_ptr[current].time < p_time) {
+		next = MIN(current + 1, key_count - 1);
+	} else {
+		// Matches the time exactly (or the time is before the first key). _fetch_compressed()
+		// stops at the start of a time key in that case, instead of the last key with that time.
+		for (int32_t i = current; i >= 0 && keys_ptr[i].time == keys_ptr[current].time; i--) {
+			if (keys_ptr[i].time_key_start) {
+				current = i;
+				break;
+			}
+		}
+		next = current;
+	}
+
+	r_current_time = keys_ptr[current].time;
+	r_next_time = keys_ptr[next].time;
+	r_current_value = keys_ptr[current].value;
+	r_next_value = keys_ptr[next].value;
+
+	return true;
+}
+
+Animation::RecentDecodedPages::RecentDecodedPages() {
+	MutexLock lock(decoded_page_cache_mutex);
+	recent_decoded_pages.push_back(this);
+}
+
+Animation::RecentDecodedPages::~RecentDecodedPages() {
+	MutexLock lock(decoded_page_cache_mutex);
+	recent_decoded_pages.erase(this);
+}
+
+void Animation::_drop_decoded_pages() {
+	if (compression.id == 0) {
+		return; // Never compressed, so nothing was decoded.
+	}
+
+	MutexLock lock(decoded_page_cache_mutex);
+	for (RecentDecodedPages *recent_pages : recent_decoded_pages) {
+		recent_pages->lock.lock();
+		for (RecentDecodedPages::Page &page : recent_pages->pages) {
+			if (page.key.compression_id == compression.id) {
+				page.key = DecodedPageKey();
+				page.keys.clear();
+			}
+		}
+		recent_pages->lock.unlock();
+	}
+
+	if (decoded_page_cache) {
+		DecodedPageKey page_key;
+		page_key.compression_id = compression.id;
+		for (page_key.page = 0; page_key.page < decoded_page_end; page_key.page++) {
+			for (page_key.track = 0; page_key.track < decoded_track_end; page_key.track++) {
+				decoded_page_cache->erase(page_key);
+			}
+		}
+	}
+	decoded_page_end = 0;
+	decoded_track_end = 0;
+}
+
+void Animation::init_decoded_page_cache() {
+	int capacity = GLOBAL_GET("animation/compression/decoded_page_cache_size");
+	MutexLock lock(decoded_page_cache_mutex);
+	decoded_page_cache = memnew(DecodedPageCache(MAX(capacity, 1)));
+}
+
+void Animation::finish_decoded_page_cache() {
+	MutexLock lock(decoded_page_cache_mutex);
+	memdelete(decoded_page_cache);
+	decoded_page_cache = nullptr;
+}
+
 template <uint32_t COMPONENTS>
 void Animation::_get_compressed_key_indices_in_range(uint32_t p_compressed_track, double p_time, double p_delta, List<int> *r_indices) const {
 	ERR_FAIL_COND(!compression.enabled);
@@ -6444,6 +6724,7 @@ Animation::Animation() {
 }
 
 Animation::~Animation() {
+	_drop_decoded_pages();
 	for (int i = 0; i < tracks.size(); i++) {
 		memdelete(tracks[i]);
 	}
@@ -34,7 +34,11 @@
 #define ANIMATION_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/lru.h"
+#include "core/templates/safe_refcount.h"
 
 #define ANIM_MIN_LENGTH 0.001
 
@@ -106,6 +110,14 @@ public:
 	};
 #endif // TOOLS_ENABLED
 
+	// Remembers which keys the last lookup in a track landed between, so a track
+	// sampled at steadily advancing times doesn't binary-search its keys every time.
+	// Owned by the caller, one per track; a stale cursor only costs a regular search.
+	struct KeyCursor {
+		int key = -1;
+		int end = -1;
+	};
+
 	struct Track {
 		TrackType type = TrackType::TYPE_ANIMATION;
 		InterpolationType interpolation = INTERPOLATION_LINEAR;
@@ -263,6 +275,8 @@ private:
 	template <typename K>
 
 	inline int _find(const Vector<K> &p_keys, double p_time, bool p_backward = false, bool p_limit = false) const;
+	template <typename K>
+	_FORCE_INLINE_ int _find_with_hint(const Vector<K> &p_keys, double p_time, bool p_backward, int &r_hint) const;
 
 	_FORCE_INLINE_ Vector3 _interpolate(const Vector3 &p_a, const Vector3 &p_b, real_t p_c) const;
 	_FORCE_INLINE_ Quaternion _interpolate(const Quaternion &p_a, const Quaternion &p_b, real_t p_c) const;
@@ -277,7 +291,7 @@ private:
 	_FORCE_INLINE_ Variant _cubic_interpolate_angle_in_time(const Variant &p_pre_a, const Variant &p_a, const Variant &p_b, const Variant &p_post_b, real_t p_c, real_t p_pre_a_t, real_t p_b_t, real_t p_post_b_t) const;
 
 	template <typename T>
-	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward = false) const;
+	_FORCE_INLINE_ T _interpolate(const Vector<TKey<T>> &p_keys, double p_time, InterpolationType p_interp, bool p_loop_wrap, bool *p_ok, bool p_backward = false, KeyCursor *r_cursor = nullptr) const;
 
 	template <typename T>
 	_FORCE_INLINE_ void _track_get_key_indices_in_range(const Vector<T> &p_array, double from_time, double to_time, List<int> *p_indices, bool p_is_backward) const;
@@ -356,8 +370,71 @@ private:
 		LocalVector<Page> pages;
 		LocalVector<AABB> bounds; // Used by position and scale tracks (which contain index to track and index to bounds).
 		bool enabled = false;
+		uint64_t id = 0; // Unique for every set of pages, identifies them in the decoded page cache.
 	} compression;
 
+	/* Decoded page cache:
+	 *
+	 * Sampling a compressed track otherwise walks the bit-packed deltas of a page from the start
+	 * of a time key on every call. Pages are decoded once per compressed track into a flat, sorted
+	 * list of keys instead, and kept in an LRU cache shared by everything sampling the same
+	 * animation, bounded by the "animation/compression/decoded_page_cache_size" setting.
+	 * Each thread also keeps a few recently used pages, so most samples don't touch the lock.
+	 * Those are registered, so that freeing or recompressing an animation drops its pages from
+	 * every thread and from the shared cache, instead of keeping them alive until they age out.
+	 */
+	struct DecodedKey {
+		double time = 0.0;
+		Vector3i value;
+		bool time_key_start = false; // First key of a time key, see _fetch_compressed().
+	};
+
+	struct DecodedPageKey {
+		uint64_t compression_id = 0;
+		uint32_t page = 0;
+		uint32_t track = 0;
+
+		uint32_t hash() const {
+			uint32_t h = hash_murmur3_one_64(compression_id);
+			h = hash_murmur3_one_32(page, h);
+			h = hash_murmur3_one_32(track, h);
+			return hash_fmix32(h);
+		}
+		bool operator==(const DecodedPageKey &p_key) const {
+			return compression_id == p_key.compression_id && page == p_key.page && track == p_key.track;
+		}
+	};
+
+	typedef LRUCache<DecodedPageKey, Vector<DecodedKey>, HashableHasher<DecodedPageKey>> DecodedPageCache;
+
+	static Mutex decoded_page_cache_mutex;
+	static DecodedPageCache *decoded_page_cache;
+	static SafeNumeric<uint64_t> compression_id_counter;
+
+	struct RecentDecodedPages {
+		static constexpr uint32_t SIZE = 64;
+
+		struct Page {
+			DecodedPageKey key;
+			Vector<DecodedKey> keys;
+		};
+
+		SpinLock lock; // Only contended while an animation drops its pages.
+		Page pages[SIZE]; // Direct mapped, so a miss only evicts one page.
+
+		RecentDecodedPages();
+		~RecentDecodedPages();
+	};
+
+	static LocalVector<RecentDecodedPages *> recent_decoded_pages; // Protected by decoded_page_cache_mutex.
+	static thread_local RecentDecodedPages thread_recent_decoded_pages;
+
+	// Pages and compressed tracks below these may be in the decoded page cache. Protected by decoded_page_cache_mutex.
+	mutable uint32_t decoded_page_end = 0;
+	mutable uint32_t decoded_track_end = 0;
+
+	void _drop_decoded_pages();
+
 	Vector3i _compress_key(uint32_t p_track, const AABB &p_bounds, int32_t p_key = -1, float p_time = 0.0);
 	bool _rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const;
 	bool _pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const;
@@ -365,6 +442,12 @@ private:
 	template <uint32_t COMPONENTS>
 	bool _fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr) const;
 	template <uint32_t COMPONENTS>
+	Vector<DecodedKey> _decode_compressed_page(uint32_t p_compressed_track, uint32_t p_page) const;
+	template <uint32_t COMPONENTS>
+	Vector<DecodedKey> _get_decoded_page(uint32_t p_compressed_track, uint32_t p_page) const;
+	template <uint32_t COMPONENTS>
+	bool _fetch_compressed_decoded(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time) const;
+	template <uint32_t COMPONENTS>
 	bool _fetch_compressed_by_index(uint32_t p_compressed_track, int p_index, Vector3i &r_value, double &r_time) const;
 	int _get_compressed_key_count(uint32_t p_compressed_track) const;
 	template <uint32_t COMPONENTS>
@@ -452,22 +535,22 @@ public:
 
 	int position_track_insert_key(int p_track, double p_time, const Vector3 &p_position);
 	Error position_track_get_key(int p_track, int p_key, Vector3 *r_position) const;
-	Error try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward = false) const;
+	Error try_position_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward = false, KeyCursor *r_cursor = nullptr) const;
 	Vector3 position_track_interpolate(int p_track, double p_time, bool p_backward = false) const;
 
 	int rotation_track_insert_key(int p_track, double p_time, const Quaternion &p_rotation);
 	Error rotation_track_get_key(int p_track, int p_key, Quaternion *r_rotation) const;
-	Error try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward = false) const;
+	Error try_rotation_track_interpolate(int p_track, double p_time, Quaternion *r_interpolation, bool p_backward = false, KeyCursor *r_cursor = nullptr) const;
 	Quaternion rotation_track_interpolate(int p_track, double p_time, bool p_backward = false) const;
 
 	int scale_track_insert_key(int p_track, double p_time, const Vector3 &p_scale);
 	Error scale_track_get_key(int p_track, int p_key, Vector3 *r_scale) const;
-	Error try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward = false) const;
+	Error try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward = false, KeyCursor *r_cursor = nullptr) const;
 	Vector3 scale_track_interpolate(int p_track, double p_time, bool p_backward = false) const;
 
 	int blend_shape_track_insert_key(int p_track, double p_time, float p_blend);
 	Error blend_shape_track_get_key(int p_track, int p_key, float *r_blend) const;
-	Error try_blend_shape_track_interpolate(int p_track, double p_time, float *r_blend, bool p_backward = false) const;
+	Error try_blend_shape_track_interpolate(int p_track, double p_time, float *r_blend, bool p_backward = false, KeyCursor *r_cursor = nullptr) const;
 	float blend_shape_track_interpolate(int p_track, double p_time, bool p_backward = false) const;
 
 	void track_set_interpolation_type(int p_track, InterpolationType p_interp);
@@ -574,6 +657,9 @@ public:
 
 	static TrackType get_cache_type(TrackType p_type);
 
+	static void init_decoded_page_cache();
+	static void finish_decoded_page_cache();
+
 	Animation();
 	~Animation();
 };
@@ -191,6 +191,7 @@ public:
 	virtual void skeleton_free(RID p_rid) override {}
 	virtual void skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) override {}
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) override {}
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) override {}
 	virtual int skeleton_get_bone_count(RID p_skeleton) const override { return 0; }
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) override {}
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const override { return Transform3D(); }
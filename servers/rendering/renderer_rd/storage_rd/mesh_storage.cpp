@@ -32,6 +32,8 @@
 
 #include "mesh_storage.h"
 
+#include "core/math/math_batch.h"
+
 using namespace RendererRD;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -1781,35 +1783,25 @@ void MeshStorage::_multimesh_re_create_aabb(MultiMesh *multimesh, const float *p
 	if (multimesh->custom_aabb != AABB()) {
 		return;
 	}
-	AABB aabb;
 	AABB mesh_aabb = mesh_get_aabb(multimesh->mesh);
+	if (multimesh->xform_format == RS::MULTIMESH_TRANSFORM_3D) {
+		// The buffer already holds row-major 3x4 matrices, which the batch kernel reads directly.
+		multimesh->aabb = MathBatch::merge_transformed_aabb(mesh_aabb, p_data, multimesh->stride_cache, p_instances);
+		return;
+	}
+
+	AABB aabb;
 	for (int i = 0; i < p_instances; i++) {
 		const float *data = p_data + multimesh->stride_cache * i;
 		Transform3D t;
 
-		if (multimesh->xform_format == RS::MULTIMESH_TRANSFORM_3D) {
-			t.basis.rows[0][0] = data[0];
-			t.basis.rows[0][1] = data[1];
-			t.basis.rows[0][2] = data[2];
-			t.origin.x = data[3];
-			t.basis.rows[1][0] = data[4];
-			t.basis.rows[1][1] = data[5];
-			t.basis.rows[1][2] = data[6];
-			t.origin.y = data[7];
-			t.basis.rows[2][0] = data[8];
-			t.basis.rows[2][1] = data[9];
-			t.basis.rows[2][2] = data[10];
-			t.origin.z = data[11];
+		t.basis.rows[0][0] = data[0];
+		t.basis.rows[0][1] = data[1];
+		t.origin.x = data[3];
 
-		} else {
-			t.basis.rows[0][0] = data[0];
-			t.basis.rows[0][1] = data[1];
-			t.origin.x = data[3];
-
-			t.basis.rows[1][0] = data[4];
-			t.basis.rows[1][1] = data[5];
-			t.origin.y = data[7];
-		}
+		t.basis.rows[1][0] = data[4];
+		t.basis.rows[1][1] = data[5];
+		t.origin.y = data[7];
 
 		if (i == 0) {
 			aabb = t.xform(mesh_aabb);
@@ -2431,6 +2423,21 @@ void MeshStorage::skeleton_set_base_transform_2d(RID p_skeleton, const Transform
 	skeleton->base_transform_2d = p_base_transform;
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	int buffer_size = skeleton->size * (skeleton->use_2d ? 8 : 12);
+	ERR_FAIL_COND(p_buffer.size() != buffer_size);
+
+	if (buffer_size == 0) {
+		return;
+	}
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), buffer_size * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 void MeshStorage::_update_dirty_skeletons() {
 	while (skeleton_dirty_list) {
 		Skeleton *skeleton = skeleton_dirty_list;
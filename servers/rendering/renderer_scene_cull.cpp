@@ -408,6 +408,7 @@ void RendererSceneCull::scenario_initialize(RID p_rid) {
 	scenario->reflection_atlas = RSG::light_storage->reflection_atlas_create();
 
 	scenario->instance_aabbs.set_page_pool(&instance_aabb_page_pool);
+	scenario->instance_cull_bounds.set_page_pool(&instance_cull_bounds_page_pool);
 	scenario->instance_data.set_page_pool(&instance_data_page_pool);
 	scenario->instance_visibility.set_page_pool(&instance_visibility_data_page_pool);
 
@@ -1905,7 +1906,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		}
 
 		p_instance->scenario->instance_data.push_back(idata);
-		p_instance->scenario->instance_aabbs.push_back(InstanceBounds(p_instance->transformed_aabb));
+		p_instance->scenario->push_instance_bounds(InstanceBounds(p_instance->transformed_aabb));
 		_update_instance_visibility_dependencies(p_instance);
 	} else {
 		if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1913,7 +1914,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) const {
 		} else {
 			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
 		}
-		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
+		p_instance->scenario->set_instance_bounds(p_instance->array_index, InstanceBounds(p_instance->transformed_aabb));
 	}
 
 	if (p_instance->visibility_index != -1) {
@@ -2003,7 +2004,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		Instance *swapped_instance = p_instance->scenario->instance_data[swap_with_index].instance;
 		swapped_instance->array_index = p_instance->array_index; //swap
 		p_instance->scenario->instance_data[p_instance->array_index] = p_instance->scenario->instance_data[swap_with_index];
-		p_instance->scenario->instance_aabbs[p_instance->array_index] = p_instance->scenario->instance_aabbs[swap_with_index];
+		p_instance->scenario->set_instance_bounds(p_instance->array_index, p_instance->scenario->instance_aabbs[swap_with_index]);
 
 		if (swapped_instance->visibility_index != -1) {
 			swapped_instance->scenario->instance_visibility[swapped_instance->visibility_index].array_index = swapped_instance->array_index;
@@ -2019,7 +2020,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 
 	// pop last
 	p_instance->scenario->instance_data.pop_back();
-	p_instance->scenario->instance_aabbs.pop_back();
+	p_instance->scenario->pop_instance_bounds();
 
 	//uninitialize
 	p_instance->array_index = -1;
@@ -2895,9 +2896,17 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
 	float z_near = cull_data.camera_matrix->get_z_near();
 
+	// The camera frustum is tested a whole pack of instances at a time, the result kept as one bit per instance.
+	const Frustum &camera_frustum = cull_data.cull->frustum;
+	uint32_t camera_frustum_mask = 0;
+
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
 
+		if (i == p_from || i % MathBatch::BoundsPack::SIZE == 0) {
+			camera_frustum_mask = MathBatch::cull_bounds_pack(camera_frustum.planes_ptr, camera_frustum.plane_count, cull_data.scenario->instance_cull_bounds[i / MathBatch::BoundsPack::SIZE]);
+		}
+
 		InstanceData &idata = cull_data.scenario->instance_data[i];
 		uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 		int32_t visibility_check = -1;
@@ -2905,13 +2914,14 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
 #define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_CAMERA_FRUSTUM ((camera_frustum_mask >> (i % MathBatch::BoundsPack::SIZE)) & 1)
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
 #define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near, cull_data.scenario->instance_data[i].occlusion_timeout))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_CAMERA_FRUSTUM && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -3130,6 +3140,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #undef HIDDEN_BY_VISIBILITY_CHECKS
 #undef LAYER_CHECK
 #undef IN_FRUSTUM
+#undef IN_CAMERA_FRUSTUM
 #undef VIS_RANGE_CHECK
 #undef VIS_PARENT_CHECK
 #undef VIS_CHECK
@@ -4252,6 +4263,7 @@ bool RendererSceneCull::free(RID p_rid) {
 			instance_set_scenario(scenario->instances.first()->self()->self, RID());
 		}
 		scenario->instance_aabbs.reset();
+		scenario->instance_cull_bounds.reset();
 		scenario->instance_data.reset();
 		scenario->instance_visibility.reset();
 
@@ -4434,6 +4446,9 @@ RendererSceneCull::RendererSceneCull() {
 	render_pass = 1;
 	singleton = this;
 
+	// Packs hold several instances each, so smaller pages keep the memory of small scenarios in line with instance_aabbs.
+	instance_cull_bounds_page_pool.configure(512);
+
 	instance_cull_result.set_page_pool(&instance_cull_page_pool);
 	instance_shadow_cull_result.set_page_pool(&instance_cull_page_pool);
 
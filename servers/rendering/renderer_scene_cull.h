@@ -34,6 +34,7 @@
 #define RENDERER_SCENE_CULL_H
 
 #include "core/math/dynamic_bvh.h"
+#include "core/math/math_batch.h"
 #include "core/math/transform_interpolator.h"
 #include "core/templates/bin_sorted_array.h"
 #include "core/templates/local_vector.h"
@@ -327,6 +328,7 @@ public:
 	};
 
 	PagedArrayPool<InstanceBounds> instance_aabb_page_pool;
+	PagedArrayPool<MathBatch::BoundsPack> instance_cull_bounds_page_pool;
 	PagedArrayPool<InstanceData> instance_data_page_pool;
 	PagedArrayPool<InstanceVisibilityData> instance_visibility_data_page_pool;
 
@@ -356,9 +358,33 @@ public:
 		LocalVector<RID> dynamic_lights;
 
 		PagedArray<InstanceBounds> instance_aabbs;
+		// Same bounds as instance_aabbs, packed for the vectorized frustum test. Always modify both through the functions below.
+		PagedArray<MathBatch::BoundsPack> instance_cull_bounds;
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
 
+		_FORCE_INLINE_ void set_instance_bounds(uint64_t p_index, const InstanceBounds &p_bounds) {
+			instance_aabbs[p_index] = p_bounds;
+			instance_cull_bounds[p_index / MathBatch::BoundsPack::SIZE].set(p_index % MathBatch::BoundsPack::SIZE,
+					Vector3(p_bounds.bounds[0], p_bounds.bounds[1], p_bounds.bounds[2]),
+					Vector3(p_bounds.bounds[3], p_bounds.bounds[4], p_bounds.bounds[5]));
+		}
+
+		_FORCE_INLINE_ void push_instance_bounds(const InstanceBounds &p_bounds) {
+			if (instance_aabbs.size() % MathBatch::BoundsPack::SIZE == 0) {
+				instance_cull_bounds.push_back(MathBatch::BoundsPack());
+			}
+			instance_aabbs.push_back(p_bounds);
+			set_instance_bounds(instance_aabbs.size() - 1, p_bounds);
+		}
+
+		_FORCE_INLINE_ void pop_instance_bounds() {
+			instance_aabbs.pop_back();
+			if (instance_aabbs.size() % MathBatch::BoundsPack::SIZE == 0) {
+				instance_cull_bounds.pop_back();
+			}
+		}
+
 		Scenario() {
 			indexers[INDEXER_GEOMETRY].set_index(INDEXER_GEOMETRY);
 			indexers[INDEXER_VOLUMES].set_index(INDEXER_VOLUMES);
@@ -68,6 +68,8 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	MemoryTagScope memory_tag(Memory::ALLOCATION_TAG_RENDERING);
+
 	RSG::rasterizer->begin_frame(frame_step);
 
 	TIMESTAMP_BEGIN()
@@ -427,6 +427,7 @@ public:
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
 	FUNC2(skeleton_set_base_transform_2d, RID, const Transform2D &)
+	FUNC2(skeleton_set_buffer, RID, const Vector<float> &)
 
 	/* Light API */
 #undef ServerName
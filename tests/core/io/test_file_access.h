@@ -34,6 +34,8 @@
 #define TEST_FILE_ACCESS_H
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_memory.h"
+#include "core/io/file_access_pack.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -201,6 +203,90 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Read a pack entry through regular and memory mapped I/O") {
+	const String pack_path = TestUtils::get_temp_path("mapped_pack.bin");
+	Ref<FileAccess> fw = FileAccess::open(pack_path, FileAccess::WRITE);
+	REQUIRE(fw.is_valid());
+	fw->store_32(0xDEADBEEF); // Data before the entry.
+	fw->store_32(0x01020304);
+	fw->store_32(5);
+	fw->store_buffer((const uint8_t *)"hello", 5);
+	fw->store_32(0xCAFEBABE); // Data after the entry.
+	fw->close();
+
+	PackedData::PackedFile pf;
+	pf.pack = pack_path;
+	pf.offset = 4;
+	pf.size = 13;
+	memset(pf.md5, 0, sizeof(pf.md5));
+	pf.encrypted = false;
+
+	Ref<FileAccess> pack = FileAccess::open(pack_path, FileAccess::READ);
+	REQUIRE(pack.is_valid());
+
+	Vector<Ref<FileAccess>> entries;
+	entries.push_back(memnew(FileAccessPack(pack_path, pf)));
+	if (pack->map_read_only()) {
+		entries.push_back(memnew(FileAccessPack(pack_path, pf, pack)));
+	} else {
+		MESSAGE("Memory mapped files aren't supported on this platform, only checking regular I/O.");
+	}
+
+	for (int i = 0; i < entries.size(); i++) {
+		const Ref<FileAccess> &f = entries[i];
+		const bool mapped = i == 1;
+		REQUIRE(f->is_open());
+		CHECK(f->get_length() == 13);
+		CHECK(f->get_32() == 0x01020304);
+		CHECK(f->get_32() == 5);
+
+		const uint8_t *view = f->get_buffer_view(5);
+		CHECK((view != nullptr) == mapped);
+		uint8_t text[5];
+		if (view) {
+			memcpy(text, view, 5);
+		} else {
+			CHECK(f->get_buffer(text, 5) == 5);
+		}
+		CHECK(memcmp(text, "hello", 5) == 0);
+		CHECK(f->get_position() == 13);
+		CHECK_FALSE(f->eof_reached());
+
+		// Reading past the end of the entry must not leak the data that follows it.
+		CHECK(f->get_buffer_view(1) == nullptr);
+		CHECK(f->get_8() == 0);
+		CHECK(f->eof_reached());
+
+		f->seek(8);
+		CHECK_FALSE(f->eof_reached());
+		CHECK(f->get_8() == 'h');
+	}
+
+	entries.clear();
+	pack.unref();
+	DirAccess::remove_file_or_error(pack_path);
+}
+
+TEST_CASE("[FileAccess] Buffer views of in-memory files stay within the data") {
+	const uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	Ref<FileAccessMemory> f;
+	f.instantiate();
+	REQUIRE(f->open_custom(data, 8) == OK);
+
+	const uint8_t *view = f->get_buffer_view(6);
+	REQUIRE(view != nullptr);
+	CHECK(view[5] == 6);
+	CHECK(f->get_buffer_view(3) == nullptr);
+	CHECK(f->get_buffer_view(2) != nullptr);
+	CHECK(f->get_position() == 8);
+
+	// seek() doesn't clamp, so the position can be past the end.
+	f->seek(20);
+	CHECK(f->get_buffer_view(1) == nullptr);
+	CHECK(f->get_buffer_view(0) == nullptr);
+	CHECK(f->get_position() == 20);
+}
+
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
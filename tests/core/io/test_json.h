@@ -37,6 +37,8 @@
 
 #include "thirdparty/doctest/doctest.h"
 
+#include "tests/test_macros.h"
+
 namespace TestJSON {
 
 // NOTE: The current JSON parser accepts many non-conformant strings such as
@@ -319,6 +321,188 @@ TEST_CASE("[JSON] Serialization") {
 		}
 	}
 }
+
+static Vector<uint8_t> utf8_bytes(const String &p_text) {
+	const CharString utf8 = p_text.utf8();
+	Vector<uint8_t> bytes;
+	bytes.resize(utf8.length());
+	memcpy(bytes.ptrw(), utf8.get_data(), utf8.length());
+	return bytes;
+}
+
+TEST_CASE("[JSON] Streaming reader events") {
+	JSONReader reader;
+	reader.open_buffer(utf8_bytes(R"({ "name": "Godette", "tags": [true, null, -1.5e2], "empty": {} })"));
+
+	CHECK(reader.next() == JSONReader::EVENT_OBJECT_BEGIN);
+	CHECK(reader.get_depth() == 1);
+	CHECK(reader.next() == JSONReader::EVENT_KEY);
+	CHECK(reader.get_string() == "name");
+	CHECK(reader.next() == JSONReader::EVENT_STRING);
+	CHECK(reader.get_string() == "Godette");
+	CHECK(reader.next() == JSONReader::EVENT_KEY);
+	CHECK(reader.get_string() == "tags");
+	CHECK(reader.next() == JSONReader::EVENT_ARRAY_BEGIN);
+	CHECK(reader.get_depth() == 2);
+	CHECK(reader.next() == JSONReader::EVENT_BOOL);
+	CHECK(reader.get_bool());
+	CHECK(reader.next() == JSONReader::EVENT_NULL);
+	CHECK(reader.next() == JSONReader::EVENT_NUMBER);
+	CHECK(reader.get_number() == doctest::Approx(-150.0));
+	CHECK(reader.next() == JSONReader::EVENT_ARRAY_END);
+	CHECK(reader.next() == JSONReader::EVENT_KEY);
+	CHECK(reader.get_string() == "empty");
+	CHECK(reader.next() == JSONReader::EVENT_OBJECT_BEGIN);
+	CHECK(reader.skip_value() == OK);
+	CHECK(reader.next() == JSONReader::EVENT_OBJECT_END);
+	CHECK(reader.get_depth() == 0);
+	CHECK(reader.next() == JSONReader::EVENT_EOF);
+}
+
+TEST_CASE("[JSON] Streaming reader matches JSON::parse") {
+	const String documents[] = {
+		"null",
+		"  \"text\"  ",
+		"[1, 2.5, -3, 1e3, true, false, null, \"\", [], {}]",
+		R"({"a": {"b": [1, {"c": "d"}]}, "e": "\u00e9\u4e2d\ud83d\ude00\n\t\"\\\/", "f": "Ünïcödé"})",
+		"[1, 2, ]",
+		"{\"trailing\": 1, }",
+	};
+
+	for (const String &document : documents) {
+		JSON json;
+		REQUIRE(json.parse(document) == OK);
+
+		JSONReader reader;
+		reader.open_buffer(utf8_bytes(document));
+		Variant value;
+		CHECK_MESSAGE(reader.parse(value) == OK, document);
+		CHECK_MESSAGE(value == json.get_data(), document);
+	}
+
+	SUBCASE("Skipping the UTF-8 BOM") {
+		JSONReader reader;
+		Vector<uint8_t> bytes = utf8_bytes("[1]");
+		bytes.insert(0, 0xBF);
+		bytes.insert(0, 0xBB);
+		bytes.insert(0, 0xEF);
+		reader.open_buffer(bytes);
+		Variant value;
+		CHECK(reader.parse(value) == OK);
+		CHECK(Array(value).size() == 1);
+	}
+}
+
+TEST_CASE("[JSON] Streaming reader typed arrays") {
+	JSONReader reader;
+	reader.open_buffer(utf8_bytes(R"({"positions": [0.5, 1, -2.25], "indices": [3, 2, 1, 0], "bad": [1, "2"]})"));
+
+	Vector<float> positions;
+	Vector<int32_t> indices;
+	REQUIRE(reader.next() == JSONReader::EVENT_OBJECT_BEGIN);
+	while (reader.next() == JSONReader::EVENT_KEY) {
+		const String key = reader.get_string();
+		reader.next();
+		if (key == "positions") {
+			CHECK(reader.read_number_array(positions) == OK);
+		} else if (key == "indices") {
+			CHECK(reader.read_number_array(indices) == OK);
+		} else {
+			Vector<double> bad;
+			CHECK(reader.read_number_array(bad) == ERR_PARSE_ERROR);
+			CHECK(reader.get_error_message() == "Expected number");
+			break;
+		}
+	}
+
+	REQUIRE(positions.size() == 3);
+	CHECK(positions[0] == 0.5f);
+	CHECK(positions[1] == 1.0f);
+	CHECK(positions[2] == -2.25f);
+	REQUIRE(indices.size() == 4);
+	CHECK(indices[0] == 3);
+	CHECK(indices[3] == 0);
+	CHECK(reader.get_event() == JSONReader::EVENT_ERROR);
+}
+
+TEST_CASE("[JSON] Streaming reader errors") {
+	const String documents[] = {
+		"[1 2]",
+		"{\"key\" 1}",
+		"{1: 2}",
+		"[\"unterminated",
+		"[\"\\x\"]",
+		"[\"\\ud800\"]",
+		"[nope]",
+		"[1] [2]",
+		"[1",
+		"[1,",
+		"{\"key\":",
+	};
+
+	for (const String &document : documents) {
+		JSON json;
+		ERR_PRINT_OFF;
+		const Error json_err = json.parse(document);
+		ERR_PRINT_ON;
+
+		JSONReader reader;
+		reader.open_buffer(utf8_bytes(document));
+		Variant value;
+		CHECK_MESSAGE(reader.parse(value) == json_err, document);
+		CHECK_MESSAGE(reader.get_error_message() == json.get_error_message(), document);
+		CHECK(value == Variant());
+	}
+
+	JSONReader reader;
+	Variant value;
+	reader.open_buffer(Vector<uint8_t>());
+	CHECK(reader.parse(value) == ERR_PARSE_ERROR);
+	CHECK(reader.get_error_message() == "Expected value, got 'EOF'");
+
+	String deep;
+	for (int i = 0; i <= Variant::MAX_RECURSION_DEPTH + 1; i++) {
+		deep += "[";
+	}
+	reader.open_buffer(utf8_bytes(deep));
+	CHECK(reader.parse(value) == ERR_OUT_OF_MEMORY);
+	CHECK(reader.get_error_message() == "JSON structure is too deep");
+
+	reader.open_buffer(utf8_bytes("[1,\n2,\n}"));
+	CHECK(reader.parse(value) == ERR_PARSE_ERROR);
+	CHECK(reader.get_error_line() == 2);
+}
+
+static String make_large_document(int p_entries) {
+	String document = "[";
+	for (int i = 0; i < p_entries; i++) {
+		document += vformat(R"({"id": %d, "name": "entry \u00e9 %d", "position": [%f, %f, %f], "alive": %s},)", i, i, i * 0.5, -i * 0.25, i * 2.0, i % 2 ? "true" : "false");
+		document += "\n";
+	}
+	document += "{}]";
+	return document;
+}
+
+TEST_CASE("[JSON] Streaming reader from a file in chunks") {
+	// Large enough for tokens to cross the boundaries between chunks.
+	const String document = make_large_document(4000);
+	const String path = TestUtils::get_temp_path("json_reader.json");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(document);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	REQUIRE(f->get_length() > 65536 * 2);
+	JSONReader reader;
+	REQUIRE(reader.open_file(f) == OK);
+	Variant value;
+	CHECK(reader.parse(value) == OK);
+	CHECK(value == JSON::parse_string(document));
+}
+
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -34,6 +34,7 @@
 #define TEST_MARSHALLS_H
 
 #include "core/io/marshalls.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -492,6 +493,102 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Packed array encoding") {
+	PackedInt32Array int32_array = { 0x12345678, -2 };
+	int r_len;
+	uint8_t buffer[16];
+
+	CHECK(encode_variant(int32_array, buffer, r_len) == OK);
+	CHECK(r_len == 16);
+	CHECK_MESSAGE(buffer[0] == 0x1f, "Variant::PACKED_INT32_ARRAY");
+	// Check size.
+	CHECK(buffer[4] == 0x02);
+	CHECK(buffer[5] == 0x00);
+	CHECK(buffer[6] == 0x00);
+	CHECK(buffer[7] == 0x00);
+	// Check values, which are always little endian.
+	CHECK(buffer[8] == 0x78);
+	CHECK(buffer[9] == 0x56);
+	CHECK(buffer[10] == 0x34);
+	CHECK(buffer[11] == 0x12);
+	CHECK(buffer[12] == 0xfe);
+	CHECK(buffer[13] == 0xff);
+	CHECK(buffer[14] == 0xff);
+	CHECK(buffer[15] == 0xff);
+}
+
+TEST_CASE("[Marshalls] Packed array round trip") {
+	Vector<Variant> arrays;
+	arrays.push_back(PackedInt32Array({ 1, -2, INT32_MAX, INT32_MIN }));
+	arrays.push_back(PackedInt64Array({ 1, -2, INT64_MAX, INT64_MIN }));
+	arrays.push_back(PackedFloat32Array({ 0.5f, -1.25f, 1e20f }));
+	arrays.push_back(PackedFloat64Array({ 0.5, -1.25, 1e200 }));
+	arrays.push_back(PackedVector2Array({ Vector2(1, 2), Vector2(-3, 4.5) }));
+	arrays.push_back(PackedVector3Array({ Vector3(1, 2, 3), Vector3(-4, 5.5, 6) }));
+	arrays.push_back(PackedVector4Array({ Vector4(1, 2, 3, 4), Vector4(-5, 6.5, 7, 8) }));
+	arrays.push_back(PackedColorArray({ Color(0.1, 0.2, 0.3, 0.4), Color(1, 0, 1, 0.5) }));
+	arrays.push_back(PackedVector3Array());
+
+	for (const Variant &array : arrays) {
+		int len;
+		CHECK(encode_variant(array, nullptr, len) == OK);
+
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		int r_len;
+		CHECK(encode_variant(array, buffer.ptrw(), r_len) == OK);
+		CHECK(r_len == len);
+
+		Variant decoded;
+		CHECK(decode_variant(decoded, buffer.ptr(), len, &r_len) == OK);
+		CHECK(r_len == len);
+		CHECK_MESSAGE(decoded == array, Variant::get_type_name(array.get_type()).utf8().get_data());
+	}
+}
+
+TEST_CASE_BENCHMARK("[Marshalls][Benchmark] Packed array encoding and decoding") {
+	const int element_count = 1 << 16;
+	const int iterations = 200;
+
+	PackedFloat32Array float32_array;
+	PackedInt64Array int64_array;
+	PackedVector3Array vector3_array;
+	PackedColorArray color_array;
+	for (int i = 0; i < element_count; i++) {
+		float32_array.push_back(i * 0.5f);
+		int64_array.push_back(int64_t(i) << 20);
+		vector3_array.push_back(Vector3(i, -i, i * 0.25));
+		color_array.push_back(Color(i / 255.0, 0.5, 0.25, 1.0));
+	}
+
+	Vector<Variant> arrays = { float32_array, int64_array, vector3_array, color_array };
+	for (const Variant &array : arrays) {
+		int len;
+		encode_variant(array, nullptr, len);
+		Vector<uint8_t> buffer;
+		buffer.resize(len);
+		uint8_t *w = buffer.ptrw();
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < iterations; i++) {
+			encode_variant(array, w, len);
+		}
+		const uint64_t encode_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		Variant decoded;
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < iterations; i++) {
+			decode_variant(decoded, buffer.ptr(), len);
+		}
+		const uint64_t decode_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		BENCHMARK_MESSAGE("%s: encode %d MiB/s, decode %d MiB/s.",
+				Variant::get_type_name(array.get_type()),
+				int64_t(double(len) * iterations / encode_usec * 1000000.0 / (1 << 20)),
+				int64_t(double(len) * iterations / decode_usec * 1000000.0 / (1 << 20)));
+	}
+}
+
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
@@ -37,6 +37,7 @@
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -168,6 +169,172 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Prefetching dependencies") {
+	const String leaf_path = TestUtils::get_temp_path("prefetch_leaf.res");
+	const String middle_path = TestUtils::get_temp_path("prefetch_middle.tres");
+	const String root_path = TestUtils::get_temp_path("prefetch_root.res");
+	{
+		Ref<Resource> leaf = memnew(Resource);
+		leaf->set_name("Leaf");
+		ResourceSaver::save(leaf, leaf_path, ResourceSaver::FLAG_CHANGE_PATH);
+		Ref<Resource> middle = memnew(Resource);
+		middle->set_name("Middle");
+		middle->set_meta("next", leaf);
+		ResourceSaver::save(middle, middle_path, ResourceSaver::FLAG_CHANGE_PATH);
+		Ref<Resource> root = memnew(Resource);
+		root->set_name("Root");
+		root->set_meta("next", middle);
+		root->set_meta("leaf", leaf);
+		ResourceSaver::save(root, root_path);
+	}
+
+	Vector<String> paths;
+	paths.push_back(root_path);
+	REQUIRE(ResourceLoader::load_threaded_prefetch(paths) == OK);
+
+	const Ref<Resource> root = ResourceLoader::load_threaded_get(root_path);
+	REQUIRE(root.is_valid());
+	CHECK(root->get_name() == "Root");
+	const Ref<Resource> middle = root->get_meta("next");
+	REQUIRE(middle.is_valid());
+	CHECK(middle->get_name() == "Middle");
+	const Ref<Resource> leaf = middle->get_meta("next");
+	REQUIRE(leaf.is_valid());
+	CHECK(leaf->get_name() == "Leaf");
+	CHECK_MESSAGE(
+			Ref<Resource>(root->get_meta("leaf")) == leaf,
+			"A dependency shared by several resources should be loaded only once.");
+
+	CHECK_MESSAGE(
+			ResourceLoader::load_threaded_get_status(root_path) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE,
+			"The prefetched load should be collected like any other threaded load.");
+}
+
+// Loads ".blocking" files only once released, to see what gets loaded in the meantime.
+class BlockingResourceLoader : public ResourceFormatLoader {
+	GDCLASS(BlockingResourceLoader, ResourceFormatLoader);
+
+public:
+	Vector<String> dependencies;
+	Semaphore release;
+
+	virtual Ref<Resource> load(const String &p_path, const String &p_original_path, Error *r_error, bool p_use_sub_threads, float *r_progress, CacheMode p_cache_mode) override {
+		release.wait();
+		if (r_error) {
+			*r_error = OK;
+		}
+		return memnew(Resource);
+	}
+
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override {
+		p_extensions->push_back("blocking");
+	}
+
+	virtual bool handles_type(const String &p_type) const override {
+		return p_type == "Resource";
+	}
+
+	virtual String get_resource_type(const String &p_path) const override {
+		return p_path.get_extension() == "blocking" ? "Resource" : "";
+	}
+
+	virtual void get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types) override {
+		for (const String &dependency : dependencies) {
+			p_dependencies->push_back(dependency);
+		}
+	}
+};
+
+TEST_CASE("[Resource] Prefetching loads dependencies without waiting for the resources needing them") {
+	const String leaf_path = TestUtils::get_temp_path("prefetch_blocked_leaf.res");
+	const String middle_path = TestUtils::get_temp_path("prefetch_blocked_middle.tres");
+	const String root_path = TestUtils::get_temp_path("prefetch_blocked_root.blocking");
+	{
+		Ref<Resource> leaf = memnew(Resource);
+		ResourceSaver::save(leaf, leaf_path, ResourceSaver::FLAG_CHANGE_PATH);
+		Ref<Resource> middle = memnew(Resource);
+		middle->set_meta("next", leaf);
+		ResourceSaver::save(middle, middle_path);
+		Ref<FileAccess> f = FileAccess::open(root_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string("blocking");
+	}
+
+	Ref<BlockingResourceLoader> loader;
+	loader.instantiate();
+	loader->dependencies.push_back(middle_path);
+	ResourceLoader::add_resource_format_loader(loader, true);
+
+	Vector<String> paths;
+	paths.push_back(root_path);
+	REQUIRE(ResourceLoader::load_threaded_prefetch(paths) == OK);
+
+	// The root can't finish loading yet, so only the prefetch can have loaded what it depends on.
+	const uint64_t timeout = OS::get_singleton()->get_ticks_msec() + 10000;
+	while (!(ResourceCache::has(middle_path) && ResourceCache::has(leaf_path)) && OS::get_singleton()->get_ticks_msec() < timeout) {
+		OS::get_singleton()->delay_usec(1000);
+	}
+	CHECK(ResourceCache::has(middle_path));
+	CHECK(ResourceCache::has(leaf_path));
+	CHECK(ResourceLoader::load_threaded_get_status(root_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS);
+
+	loader->release.post();
+	CHECK(ResourceLoader::load_threaded_get(root_path).is_valid());
+
+	ResourceLoader::remove_resource_format_loader(loader);
+}
+
+TEST_CASE("[Resource] Loading a single sub-resource on demand") {
+	const String save_path = TestUtils::get_temp_path("sub_resources.res");
+	{
+		Ref<Resource> resource = memnew(Resource);
+		resource->set_name("Main");
+		Ref<Resource> first = memnew(Resource);
+		first->set_name("First");
+		first->set_scene_unique_id("first");
+		Ref<Resource> second = memnew(Resource);
+		second->set_name("Second");
+		second->set_scene_unique_id("second");
+		Ref<Resource> nested = memnew(Resource);
+		nested->set_name("Nested");
+		nested->set_scene_unique_id("nested");
+		second->set_meta("nested", nested);
+		resource->set_meta("first", first);
+		resource->set_meta("second", second);
+		ResourceSaver::save(resource, save_path);
+	}
+
+	const Ref<Resource> second = ResourceLoader::load(save_path + "::second");
+	REQUIRE(second.is_valid());
+	CHECK(second->get_name() == "Second");
+	const Ref<Resource> nested = second->get_meta("nested");
+	REQUIRE(nested.is_valid());
+	CHECK_MESSAGE(
+			nested->get_name() == "Nested",
+			"Sub-resources referenced by the requested one should be loaded along with it.");
+	CHECK(second->get_path() == save_path + "::second");
+
+	CHECK_MESSAGE(
+			!ResourceCache::has(save_path + "::first"),
+			"Sub-resources not referenced by the requested one should not be loaded.");
+	CHECK_MESSAGE(
+			!ResourceCache::has(save_path),
+			"The main resource should not be loaded.");
+
+	Error err = OK;
+	ERR_PRINT_OFF;
+	CHECK(ResourceLoader::load(save_path + "::missing", "", ResourceFormatLoader::CACHE_MODE_REUSE, &err).is_null());
+	ERR_PRINT_ON;
+	CHECK(err != OK);
+
+	const Ref<Resource> resource = ResourceLoader::load(save_path);
+	REQUIRE(resource.is_valid());
+	CHECK_MESSAGE(
+			Ref<Resource>(resource->get_meta("second")) == second,
+			"Loading the whole file afterwards should reuse the cached sub-resource.");
+	CHECK(Ref<Resource>(resource->get_meta("first"))->get_name() == "First");
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
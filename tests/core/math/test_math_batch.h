@@ -0,0 +1,428 @@
+/**************************************************************************/
+/*  test_math_batch.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MATH_BATCH_H
+#define TEST_MATH_BATCH_H
+
+#include "core/math/math_batch.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMathBatch {
+
+static Transform3D random_transform(RandomPCG &p_rng) {
+	Transform3D t;
+	for (int i = 0; i < 3; i++) {
+		t.basis.rows[i] = Vector3(p_rng.random(-2.0, 2.0), p_rng.random(-2.0, 2.0), p_rng.random(-2.0, 2.0));
+	}
+	t.origin = Vector3(p_rng.random(-10.0, 10.0), p_rng.random(-10.0, 10.0), p_rng.random(-10.0, 10.0));
+	return t;
+}
+
+static AABB random_aabb(RandomPCG &p_rng) {
+	return AABB(Vector3(p_rng.random(-10.0, 10.0), p_rng.random(-10.0, 10.0), p_rng.random(-10.0, 10.0)),
+			Vector3(p_rng.random(0.0, 4.0), p_rng.random(0.0, 4.0), p_rng.random(0.0, 4.0)));
+}
+
+static bool is_aabb_approx(const AABB &p_a, const AABB &p_b) {
+	return p_a.position.is_equal_approx(p_b.position) && p_a.size.is_equal_approx(p_b.size);
+}
+
+// Odd counts, so every kernel also goes through its scalar tail.
+static const uint32_t COUNTS[] = { 0, 1, 3, 4, 7, 8, 9, 31, 100 };
+
+TEST_CASE("[MathBatch] Transform points") {
+	RandomPCG rng(1234);
+	for (uint32_t count : COUNTS) {
+		const Transform3D t = random_transform(rng);
+		LocalVector<Vector3> points;
+		LocalVector<Vector3> result;
+		points.resize(count);
+		result.resize(count);
+		for (Vector3 &p : points) {
+			p = Vector3(rng.random(-10.0, 10.0), rng.random(-10.0, 10.0), rng.random(-10.0, 10.0));
+		}
+
+		MathBatch::transform_points(t, points.ptr(), result.ptr(), count);
+		bool match = true;
+		for (uint32_t i = 0; i < count; i++) {
+			match = match && result[i].is_equal_approx(t.xform(points[i]));
+		}
+		CHECK_MESSAGE(match, vformat("Points should match Transform3D::xform() with %d elements.", count));
+
+		// In place.
+		MathBatch::transform_points(t, points.ptr(), points.ptr(), count);
+		match = true;
+		for (uint32_t i = 0; i < count; i++) {
+			match = match && result[i].is_equal_approx(points[i]);
+		}
+		CHECK_MESSAGE(match, vformat("In place results should match with %d elements.", count));
+	}
+}
+
+TEST_CASE("[MathBatch] Multiply transforms") {
+	RandomPCG rng(5678);
+	for (uint32_t count : COUNTS) {
+		const Transform3D parent = random_transform(rng);
+		LocalVector<Transform3D> transforms;
+		LocalVector<Transform3D> result;
+		transforms.resize(count);
+		result.resize(count);
+		for (Transform3D &t : transforms) {
+			t = random_transform(rng);
+		}
+
+		MathBatch::multiply_transforms(parent, transforms.ptr(), result.ptr(), count);
+		bool match = true;
+		for (uint32_t i = 0; i < count; i++) {
+			match = match && result[i].is_equal_approx(parent * transforms[i]);
+		}
+		CHECK_MESSAGE(match, vformat("Transforms should match Transform3D::operator*() with %d elements.", count));
+	}
+}
+
+TEST_CASE("[MathBatch] Transform and merge AABBs") {
+	RandomPCG rng(9012);
+	for (uint32_t count : COUNTS) {
+		LocalVector<Transform3D> transforms;
+		LocalVector<AABB> aabbs;
+		LocalVector<AABB> result;
+		transforms.resize(count);
+		aabbs.resize(count);
+		result.resize(count);
+		for (uint32_t i = 0; i < count; i++) {
+			transforms[i] = random_transform(rng);
+			aabbs[i] = random_aabb(rng);
+		}
+
+		MathBatch::transform_aabbs(transforms.ptr(), aabbs.ptr(), result.ptr(), count);
+		bool match = true;
+		for (uint32_t i = 0; i < count; i++) {
+			match = match && is_aabb_approx(result[i], transforms[i].xform(aabbs[i]));
+		}
+		CHECK_MESSAGE(match, vformat("AABBs should match Transform3D::xform() with %d elements.", count));
+
+		if (count == 0) {
+			CHECK(MathBatch::transform_and_merge_aabbs(Transform3D(), aabbs.ptr(), 0) == AABB());
+			continue;
+		}
+
+		AABB expected = transforms[0].xform(aabbs[0]);
+		for (uint32_t i = 1; i < count; i++) {
+			expected.merge_with(transforms[0].xform(aabbs[i]));
+		}
+		CHECK(is_aabb_approx(MathBatch::transform_and_merge_aabbs(transforms[0], aabbs.ptr(), count), expected));
+
+		// MultiMesh layout: row-major 3x4 float matrices, with some custom data after each.
+		const uint32_t stride = 16;
+		LocalVector<float> buffer;
+		buffer.resize(count * stride);
+		expected = transforms[0].xform(aabbs[0]);
+		for (uint32_t i = 0; i < count; i++) {
+			float *data = &buffer[i * stride];
+			for (int r = 0; r < 3; r++) {
+				data[r * 4 + 0] = transforms[i].basis.rows[r][0];
+				data[r * 4 + 1] = transforms[i].basis.rows[r][1];
+				data[r * 4 + 2] = transforms[i].basis.rows[r][2];
+				data[r * 4 + 3] = transforms[i].origin[r];
+			}
+			expected.merge_with(transforms[i].xform(aabbs[0]));
+		}
+		CHECK(is_aabb_approx(MathBatch::merge_transformed_aabb(aabbs[0], buffer.ptr(), stride, count), expected));
+	}
+}
+
+TEST_CASE("[MathBatch] Cull AABBs against planes") {
+	// A 2x2x2 box centered at the origin, normals pointing outwards.
+	const Plane box[6] = {
+		Plane(Vector3(1, 0, 0), 1),
+		Plane(Vector3(-1, 0, 0), 1),
+		Plane(Vector3(0, 1, 0), 1),
+		Plane(Vector3(0, -1, 0), 1),
+		Plane(Vector3(0, 0, 1), 1),
+		Plane(Vector3(0, 0, -1), 1),
+	};
+	const AABB aabbs[5] = {
+		AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)), // Inside.
+		AABB(Vector3(0.5, 0.5, 0.5), Vector3(2, 2, 2)), // Crossing a corner.
+		AABB(Vector3(1.5, 0, 0), Vector3(1, 1, 1)), // Outside along +X.
+		AABB(Vector3(0, 0, -3), Vector3(1, 1, 1)), // Outside along -Z.
+		AABB(Vector3(-5, -5, -5), Vector3(10, 10, 10)), // Containing the box.
+	};
+	uint8_t inside[5];
+	CHECK(MathBatch::cull_aabbs(box, 6, aabbs, 5, inside) == 3);
+	CHECK(inside[0] == 1);
+	CHECK(inside[1] == 1);
+	CHECK(inside[2] == 0);
+	CHECK(inside[3] == 0);
+	CHECK(inside[4] == 1);
+
+	// Against random planes, the result should match testing each plane separately.
+	RandomPCG rng(3456);
+	for (uint32_t plane_count = 0; plane_count <= 12; plane_count++) {
+		Plane planes[12];
+		for (uint32_t i = 0; i < plane_count; i++) {
+			planes[i] = Plane(Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)).normalized(), rng.random(-5.0, 5.0));
+		}
+		AABB random_aabbs[64];
+		uint8_t random_inside[64];
+		for (AABB &aabb : random_aabbs) {
+			aabb = random_aabb(rng);
+		}
+		MathBatch::cull_aabbs(planes, plane_count, random_aabbs, 64, random_inside);
+
+		bool match = true;
+		for (uint32_t i = 0; i < 64; i++) {
+			bool expected = true;
+			for (uint32_t j = 0; j < plane_count; j++) {
+				expected = expected && !planes[j].is_point_over(random_aabbs[i].get_support(-planes[j].normal));
+			}
+			match = match && bool(random_inside[i]) == expected;
+		}
+		CHECK_MESSAGE(match, vformat("Culling should match per-plane tests with %d planes.", plane_count));
+	}
+}
+
+static void pack_aabbs(const LocalVector<AABB> &p_aabbs, LocalVector<MathBatch::BoundsPack> &r_packs) {
+	r_packs.resize((p_aabbs.size() + MathBatch::BoundsPack::SIZE - 1) / MathBatch::BoundsPack::SIZE);
+	for (uint32_t i = 0; i < p_aabbs.size(); i++) {
+		r_packs[i / MathBatch::BoundsPack::SIZE].set(i % MathBatch::BoundsPack::SIZE, p_aabbs[i].position, p_aabbs[i].get_end());
+	}
+}
+
+TEST_CASE("[MathBatch] Cull packed bounds against planes") {
+	const Plane box[6] = {
+		Plane(Vector3(1, 0, 0), 1),
+		Plane(Vector3(-1, 0, 0), 1),
+		Plane(Vector3(0, 1, 0), 1),
+		Plane(Vector3(0, -1, 0), 1),
+		Plane(Vector3(0, 0, 1), 1),
+		Plane(Vector3(0, 0, -1), 1),
+	};
+	LocalVector<AABB> aabbs;
+	aabbs.push_back(AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1))); // Inside.
+	aabbs.push_back(AABB(Vector3(0.5, 0.5, 0.5), Vector3(2, 2, 2))); // Crossing a corner.
+	aabbs.push_back(AABB(Vector3(1.5, 0, 0), Vector3(1, 1, 1))); // Outside along +X.
+	aabbs.push_back(AABB(Vector3(0, 0, -3), Vector3(1, 1, 1))); // Outside along -Z.
+	aabbs.push_back(AABB(Vector3(-5, -5, -5), Vector3(10, 10, 10))); // Containing the box.
+	aabbs.push_back(AABB(Vector3(1, 0, 0), Vector3(1, 1, 1))); // Touching the +X plane from outside.
+	LocalVector<MathBatch::BoundsPack> packs;
+	pack_aabbs(aabbs, packs);
+	const uint32_t mask = MathBatch::cull_bounds_pack(box, 6, packs[0]) & 0b111111;
+	CHECK(mask == 0b010011);
+	CHECK(MathBatch::cull_bounds_pack(box, 0, packs[0]) == (1u << MathBatch::BoundsPack::SIZE) - 1);
+
+	// Against random planes, the result should match testing the nearest corner of each box.
+	RandomPCG rng(4567);
+	for (uint32_t plane_count = 1; plane_count <= 12; plane_count++) {
+		Plane planes[12];
+		for (uint32_t i = 0; i < plane_count; i++) {
+			planes[i] = Plane(Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)).normalized(), rng.random(-5.0, 5.0));
+		}
+		aabbs.resize(61);
+		for (AABB &aabb : aabbs) {
+			aabb = random_aabb(rng);
+		}
+		pack_aabbs(aabbs, packs);
+
+		bool match = true;
+		for (uint32_t i = 0; i < aabbs.size(); i++) {
+			bool expected = true;
+			for (uint32_t j = 0; j < plane_count; j++) {
+				expected = expected && planes[j].distance_to(aabbs[i].get_support(-planes[j].normal)) < 0;
+			}
+			const uint32_t result = MathBatch::cull_bounds_pack(planes, plane_count, packs[i / MathBatch::BoundsPack::SIZE]);
+			match = match && bool((result >> (i % MathBatch::BoundsPack::SIZE)) & 1) == expected;
+		}
+		CHECK_MESSAGE(match, vformat("Packed culling should match per-box tests with %d planes.", plane_count));
+	}
+}
+
+template <typename F>
+static uint64_t benchmark_usec(int p_iterations, F p_function) {
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_iterations; i++) {
+		p_function();
+	}
+	return MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+}
+
+TEST_CASE_BENCHMARK("[MathBatch][Benchmark] Batch kernels against scalar loops") {
+	const uint32_t count = 10000;
+	const int iterations = 200;
+	RandomPCG rng(42);
+
+	LocalVector<Vector3> points;
+	LocalVector<Vector3> points_result;
+	LocalVector<Transform3D> transforms;
+	LocalVector<Transform3D> transforms_result;
+	LocalVector<AABB> aabbs;
+	LocalVector<AABB> aabbs_result;
+	LocalVector<uint8_t> inside;
+	points.resize(count);
+	points_result.resize(count);
+	transforms.resize(count);
+	transforms_result.resize(count);
+	aabbs.resize(count);
+	aabbs_result.resize(count);
+	inside.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		points[i] = Vector3(rng.random(-10.0, 10.0), rng.random(-10.0, 10.0), rng.random(-10.0, 10.0));
+		transforms[i] = random_transform(rng);
+		aabbs[i] = random_aabb(rng);
+	}
+	const Transform3D parent = random_transform(rng);
+	Plane frustum[6];
+	for (Plane &plane : frustum) {
+		plane = Plane(Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)).normalized(), rng.random(0.0, 10.0));
+	}
+
+	BENCHMARK_MESSAGE("Kernels built for %s, %d elements.", MathBatch::get_simd_name(), count);
+
+	const auto report = [](const char *p_name, uint64_t p_scalar_usec, uint64_t p_batch_usec) {
+		BENCHMARK_MESSAGE("%s: scalar %d usec, batch %d usec (%.2fx).", p_name, p_scalar_usec, p_batch_usec, double(p_scalar_usec) / p_batch_usec);
+	};
+
+	report("Transform points",
+			benchmark_usec(iterations, [&]() {
+				for (uint32_t i = 0; i < count; i++) {
+					points_result[i] = parent.xform(points[i]);
+				}
+			}),
+			benchmark_usec(iterations, [&]() { MathBatch::transform_points(parent, points.ptr(), points_result.ptr(), count); }));
+
+	report("Multiply transforms",
+			benchmark_usec(iterations, [&]() {
+				for (uint32_t i = 0; i < count; i++) {
+					transforms_result[i] = parent * transforms[i];
+				}
+			}),
+			benchmark_usec(iterations, [&]() { MathBatch::multiply_transforms(parent, transforms.ptr(), transforms_result.ptr(), count); }));
+
+	report("Transform AABBs",
+			benchmark_usec(iterations, [&]() {
+				for (uint32_t i = 0; i < count; i++) {
+					aabbs_result[i] = transforms[i].xform(aabbs[i]);
+				}
+			}),
+			benchmark_usec(iterations, [&]() { MathBatch::transform_aabbs(transforms.ptr(), aabbs.ptr(), aabbs_result.ptr(), count); }));
+
+	AABB merged;
+	report("Transform and merge AABBs",
+			benchmark_usec(iterations, [&]() {
+				merged = parent.xform(aabbs[0]);
+				for (uint32_t i = 1; i < count; i++) {
+					merged.merge_with(parent.xform(aabbs[i]));
+				}
+			}),
+			benchmark_usec(iterations, [&]() { merged = MathBatch::transform_and_merge_aabbs(parent, aabbs.ptr(), count); }));
+
+	report("Cull AABBs (6 planes)",
+			benchmark_usec(iterations, [&]() {
+				for (uint32_t i = 0; i < count; i++) {
+					bool in = true;
+					for (const Plane &plane : frustum) {
+						in = in && !plane.is_point_over(aabbs[i].get_support(-plane.normal));
+					}
+					inside[i] = in;
+				}
+			}),
+			benchmark_usec(iterations, [&]() { MathBatch::cull_aabbs(frustum, 6, aabbs.ptr(), count, inside.ptr()); }));
+}
+
+TEST_CASE_BENCHMARK("[MathBatch][Benchmark] Frustum cull of packed bounds against per-instance bounds") {
+	RandomPCG rng(43);
+	Plane frustum[6];
+	for (Plane &plane : frustum) {
+		plane = Plane(Vector3(rng.random(-1.0, 1.0), rng.random(-1.0, 1.0), rng.random(-1.0, 1.0)).normalized(), rng.random(0.0, 10.0));
+	}
+	// Which of the minimum (0-2) or maximum (3-5) bounds is the corner nearest to each plane, as the scene cull stores them.
+	uint32_t signs[6][3];
+	for (int i = 0; i < 6; i++) {
+		for (int j = 0; j < 3; j++) {
+			signs[i][j] = frustum[i].normal[j] > 0 ? j : j + 3;
+		}
+	}
+
+	BENCHMARK_MESSAGE("Kernels built for %s.", MathBatch::get_simd_name());
+
+	for (uint32_t count : { 100000u, 1000000u }) {
+		const int iterations = 20;
+		LocalVector<AABB> aabbs;
+		LocalVector<real_t> bounds;
+		LocalVector<MathBatch::BoundsPack> packs;
+		aabbs.resize(count);
+		bounds.resize(count * 6);
+		for (uint32_t i = 0; i < count; i++) {
+			aabbs[i] = random_aabb(rng);
+			const Vector3 end = aabbs[i].get_end();
+			for (int j = 0; j < 3; j++) {
+				bounds[i * 6 + j] = aabbs[i].position[j];
+				bounds[i * 6 + j + 3] = end[j];
+			}
+		}
+		pack_aabbs(aabbs, packs);
+
+		uint32_t visible_scalar = 0;
+		const uint64_t scalar_usec = benchmark_usec(iterations, [&]() {
+			visible_scalar = 0;
+			for (uint32_t i = 0; i < count; i++) {
+				const real_t *b = &bounds[i * 6];
+				bool in = true;
+				for (int j = 0; j < 6 && in; j++) {
+					in = frustum[j].distance_to(Vector3(b[signs[j][0]], b[signs[j][1]], b[signs[j][2]])) < 0;
+				}
+				visible_scalar += in;
+			}
+		});
+
+		uint32_t visible_packed = 0;
+		const uint64_t packed_usec = benchmark_usec(iterations, [&]() {
+			visible_packed = 0;
+			for (const MathBatch::BoundsPack &pack : packs) {
+				for (uint32_t mask = MathBatch::cull_bounds_pack(frustum, 6, pack); mask; mask &= mask - 1) {
+					visible_packed++;
+				}
+			}
+		});
+
+		// Counts can differ by a few boxes touching a plane, where fused multiply-add rounds differently.
+		BENCHMARK_MESSAGE("%d instances, %d/%d visible: per instance %d usec, packed %d usec (%.2fx).", count, visible_scalar, visible_packed, scalar_usec / iterations, packed_usec / iterations, double(scalar_usec) / packed_usec);
+	}
+}
+
+} // namespace TestMathBatch
+
+#endif // TEST_MATH_BATCH_H
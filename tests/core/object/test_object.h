@@ -33,11 +33,15 @@
 #ifndef TEST_OBJECT_H
 #define TEST_OBJECT_H
 
+#include "core/io/packet_peer.h"
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 #ifdef SANITIZERS_ENABLED
 #ifdef __has_feature
@@ -466,6 +470,55 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Emitting to a method bound in ClassDB should pass the signal arguments") {
+		Object target;
+		object.connect("my_custom_signal", Callable(&target, "set_meta"));
+
+		// Exact argument types, and types the method has to convert.
+		object.emit_signal("my_custom_signal", StringName("exact"), 1);
+		object.emit_signal("my_custom_signal", String("converted"), 2);
+		CHECK(target.get_meta("exact") == Variant(1));
+		CHECK(target.get_meta("converted") == Variant(2));
+
+		ERR_PRINT_OFF;
+		Error err = object.emit_signal("my_custom_signal", 3);
+		ERR_PRINT_ON;
+		CHECK(err == ERR_METHOD_NOT_FOUND);
+	}
+
+	SUBCASE("Connections changed after an emission should apply to the next one") {
+		Object first;
+		Object second;
+		object.connect("my_custom_signal", Callable(&first, "set_meta"), Object::CONNECT_ONE_SHOT);
+		object.emit_signal("my_custom_signal", StringName("value"), 1);
+
+		object.connect("my_custom_signal", Callable(&second, "set_meta"));
+		object.emit_signal("my_custom_signal", StringName("value"), 2);
+		CHECK(first.get_meta("value") == Variant(1));
+		CHECK(second.get_meta("value") == Variant(2));
+
+		object.disconnect("my_custom_signal", Callable(&second, "set_meta"));
+		object.emit_signal("my_custom_signal", StringName("value"), 3);
+		CHECK(second.get_meta("value") == Variant(2));
+	}
+
+	SUBCASE("Emitting to a method bound in ClassDB that returns a value should release the result") {
+		Object string_target;
+		object.connect("my_custom_signal", Callable(&string_target, "get_class"));
+
+		Ref<StreamPeerBuffer> buffer;
+		buffer.instantiate();
+		Ref<PacketPeerStream> ref_target;
+		ref_target.instantiate();
+		ref_target->set_stream_peer(buffer);
+		const int reference_count = buffer->get_reference_count();
+		object.connect("my_custom_signal", Callable(ref_target.ptr(), "get_stream_peer"));
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(buffer->get_reference_count() == reference_count);
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -604,6 +657,144 @@ TEST_CASE("[Object] Destruction at the end of the call chain is safe") {
 			"Object was tail-deleted without crashes.");
 }
 
+struct ObjectDBLookupData {
+	const Vector<ObjectID> *ids = nullptr;
+	const Vector<Object *> *objects = nullptr;
+	int iterations = 0;
+	int offset = 0;
+	int found = 0;
+	int mismatched = 0;
+	SafeFlag *stop = nullptr;
+};
+
+static void objectdb_lookup(void *p_userdata) {
+	ObjectDBLookupData *d = (ObjectDBLookupData *)p_userdata;
+	const int count = d->ids->size();
+	for (int i = 0; i < d->iterations || (d->stop && !d->stop->is_set()); i++) {
+		const int index = (i + d->offset) % count;
+		Object *object = ObjectDB::get_instance((*d->ids)[index]);
+		if (object) {
+			d->found++;
+			if (object != (*d->objects)[index]) {
+				d->mismatched++;
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB lookups from several threads while instances are freed") {
+	const int object_count = 2048;
+	const int thread_count = 4;
+
+	Vector<ObjectID> ids;
+	Vector<Object *> objects;
+	for (int i = 0; i < object_count; i++) {
+		Object *object = memnew(Object);
+		objects.push_back(object);
+		ids.push_back(object->get_instance_id());
+	}
+
+	SafeFlag stop;
+	ObjectDBLookupData data[thread_count];
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		data[i].ids = &ids;
+		data[i].objects = &objects;
+		data[i].offset = i * 509;
+		data[i].stop = &stop;
+		threads[i].start(objectdb_lookup, &data[i]);
+	}
+
+	// Free every other object and allocate new ones, which reuse the freed slots
+	// with new validators. Stale IDs must never resolve to the new objects.
+	Vector<Object *> replacements;
+	for (int i = 0; i < object_count; i += 2) {
+		memdelete(objects[i]);
+		replacements.push_back(memnew(Object));
+	}
+	stop.set();
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+		CHECK(data[i].mismatched == 0);
+	}
+
+	for (int i = 0; i < object_count; i++) {
+		if (i % 2 == 0) {
+			CHECK(ObjectDB::get_instance(ids[i]) == nullptr);
+		} else {
+			CHECK(ObjectDB::get_instance(ids[i]) == objects[i]);
+			memdelete(objects[i]);
+		}
+	}
+	for (Object *object : replacements) {
+		CHECK(ObjectDB::get_instance(object->get_instance_id()) == object);
+		memdelete(object);
+	}
+}
+
+TEST_CASE_BENCHMARK("[Object][Benchmark] ObjectDB lookups from several threads") {
+	const int object_count = 4096;
+	const int iterations = 2000000;
+
+	Vector<ObjectID> ids;
+	Vector<Object *> objects;
+	for (int i = 0; i < object_count; i++) {
+		Object *object = memnew(Object);
+		objects.push_back(object);
+		ids.push_back(object->get_instance_id());
+	}
+
+	for (int thread_count = 1; thread_count <= 16; thread_count *= 2) {
+		Vector<ObjectDBLookupData> data;
+		data.resize(thread_count);
+		for (int i = 0; i < thread_count; i++) {
+			ObjectDBLookupData &d = data.write[i];
+			d.ids = &ids;
+			d.objects = &objects;
+			d.offset = i * 997;
+			d.iterations = iterations;
+		}
+		const uint64_t usec = TestUtils::time_threads(thread_count, [](void *p_data, int p_index) { objectdb_lookup(&((ObjectDBLookupData *)p_data)[p_index]); }, data.ptrw());
+
+		BENCHMARK_MESSAGE("%d threads: %d lookups/s.",
+				thread_count,
+				int64_t(thread_count * iterations * 1000000.0 / usec));
+	}
+
+	for (Object *object : objects) {
+		memdelete(object);
+	}
+}
+
+TEST_CASE_BENCHMARK("[Object][Benchmark] Signal emission") {
+	const int emits = 200000;
+
+	for (int connection_count : { 1, 10, 100 }) {
+		Object emitter;
+		emitter.add_user_signal(MethodInfo("benchmark_signal"));
+		Vector<Object *> targets;
+		for (int i = 0; i < connection_count; i++) {
+			Object *target = memnew(Object);
+			targets.push_back(target);
+			emitter.connect("benchmark_signal", Callable(target, "get_instance_id"));
+		}
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emits; i++) {
+			emitter.emit_signal("benchmark_signal");
+		}
+		const uint64_t usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		BENCHMARK_MESSAGE("%d connections: %d emits/s.",
+				connection_count,
+				int64_t(emits * 1000000.0 / usec));
+
+		for (Object *target : targets) {
+			memdelete(target);
+		}
+	}
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
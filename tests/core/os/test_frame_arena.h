@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/os/frame_arena.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Allocations are aligned and don't overlap") {
+	FrameArena arena;
+
+	uint8_t *a = (uint8_t *)arena.alloc(3);
+	uint8_t *b = (uint8_t *)arena.alloc(100);
+	uint8_t *c = (uint8_t *)arena.alloc(1);
+	CHECK((uintptr_t)a % alignof(max_align_t) == 0);
+	CHECK((uintptr_t)b % alignof(max_align_t) == 0);
+	CHECK((uintptr_t)c % alignof(max_align_t) == 0);
+	CHECK(b >= a + 3);
+	CHECK(c >= b + 100);
+
+	CHECK(arena.owns(a));
+	CHECK(arena.owns(c));
+	int on_stack = 0;
+	CHECK_FALSE(arena.owns(&on_stack));
+}
+
+TEST_CASE("[FrameArena] Latest allocation can be freed and grown in place") {
+	FrameArena arena;
+
+	void *a = arena.alloc(16);
+	const size_t used = arena.get_used_bytes();
+	void *b = arena.alloc(32);
+	arena.free(b);
+	CHECK(arena.get_used_bytes() == used);
+
+	// Freeing anything but the latest allocation is deferred to reset().
+	void *c = arena.alloc(32);
+	arena.free(a);
+	CHECK(arena.get_used_bytes() > used);
+
+	memset(c, 0xAB, 32);
+	void *grown = arena.realloc(c, 256);
+	CHECK(grown == c);
+	CHECK(((uint8_t *)grown)[31] == 0xAB);
+
+	// Not the latest anymore, so it has to move (keeping the contents).
+	arena.alloc(8);
+	void *moved = arena.realloc(grown, 512);
+	CHECK(moved != grown);
+	CHECK(((uint8_t *)moved)[0] == 0xAB);
+	CHECK(((uint8_t *)moved)[31] == 0xAB);
+}
+
+TEST_CASE("[FrameArena] Reset reuses memory and merges chunks") {
+	FrameArena arena;
+
+	arena.alloc(64);
+	// Bigger than a chunk, so it needs another one.
+	arena.alloc(1024 * 1024);
+	const size_t capacity = arena.get_capacity();
+	CHECK(capacity >= 1024 * 1024);
+	CHECK(arena.get_peak_used_bytes() >= 1024 * 1024);
+
+	arena.reset();
+	CHECK(arena.get_used_bytes() == 0);
+	CHECK(arena.get_capacity() == capacity);
+
+	// Everything from the last frame now fits in a single chunk.
+	uint8_t *a = (uint8_t *)arena.alloc(64);
+	uint8_t *b = (uint8_t *)arena.alloc(1024 * 1024);
+	CHECK(arena.get_capacity() == capacity);
+	CHECK(b > a);
+}
+
+TEST_CASE("[FrameArena] Scope rewinds allocations") {
+	FrameArena arena;
+
+	arena.alloc(32);
+	const size_t used = arena.get_used_bytes();
+	{
+		FrameArena::Scope scope(arena);
+		for (int i = 0; i < 100; i++) {
+			arena.alloc(1000);
+		}
+		CHECK(arena.get_used_bytes() > used);
+	}
+	CHECK(arena.get_used_bytes() == used);
+}
+
+TEST_CASE("[FrameArena] FrameLocalVector") {
+	FrameArena::Scope scope;
+
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 1000);
+	CHECK(FrameArena::get_thread_arena().owns(vector.ptr()));
+
+	bool all_kept = true;
+	for (int i = 0; i < 1000; i++) {
+		all_kept &= vector[i] == i;
+	}
+	CHECK(all_kept);
+
+	vector.reset();
+	CHECK(vector.ptr() == nullptr);
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
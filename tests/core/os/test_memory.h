@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+TEST_CASE("[Memory] Allocation tracking counts allocations per tag") {
+	Memory::reset_allocation_tracking();
+	Memory::set_allocation_tracking_enabled(true, 1);
+
+	{
+		MemoryTagScope tag(Memory::ALLOCATION_TAG_PHYSICS);
+		for (int i = 0; i < 10; i++) {
+			Memory::free_static(Memory::alloc_static(100));
+		}
+	}
+	// Outside the scope, allocations go back to being untagged.
+	Memory::free_static(Memory::alloc_static(50));
+
+	Memory::set_allocation_tracking_enabled(false);
+
+	const Memory::AllocationStats physics = Memory::get_total_allocation_stats(Memory::ALLOCATION_TAG_PHYSICS);
+	CHECK(physics.count == 10);
+	CHECK(physics.bytes == 1000);
+	const Memory::AllocationStats untagged = Memory::get_total_allocation_stats(Memory::ALLOCATION_TAG_UNTAGGED);
+	CHECK(untagged.count >= 1);
+	CHECK(untagged.bytes >= 50);
+	CHECK(Memory::get_total_allocation_stats().count >= 11);
+
+	// Not counted while disabled.
+	Memory::free_static(Memory::alloc_static(100));
+	CHECK(Memory::get_total_allocation_stats(Memory::ALLOCATION_TAG_PHYSICS).count == 10);
+
+	Memory::reset_allocation_tracking();
+}
+
+TEST_CASE("[Memory] Allocation tracking per-frame stats and sites") {
+	Memory::reset_allocation_tracking();
+	Memory::set_allocation_tracking_enabled(true, 1);
+
+	Memory::end_allocation_frame();
+	{
+		MemoryTagScope tag(Memory::ALLOCATION_TAG_RENDERING);
+		for (int i = 0; i < 4; i++) {
+			Memory::free_static(Memory::alloc_static(64));
+		}
+	}
+	Memory::end_allocation_frame();
+	CHECK(Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_RENDERING).count == 4);
+	CHECK(Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_RENDERING).bytes == 256);
+
+	// An empty frame.
+	Memory::end_allocation_frame();
+	CHECK(Memory::get_frame_allocation_stats(Memory::ALLOCATION_TAG_RENDERING).count == 0);
+
+	Memory::set_allocation_tracking_enabled(false);
+
+	Memory::AllocationSite sites[8];
+	const uint32_t site_count = Memory::get_allocation_sites(sites, 8);
+	REQUIRE(site_count >= 1);
+	bool found = false;
+	for (uint32_t i = 0; i < site_count; i++) {
+		CHECK(sites[i].address != nullptr);
+		if (i > 0) {
+			CHECK(sites[i - 1].samples >= sites[i].samples);
+		}
+		if (sites[i].tag == Memory::ALLOCATION_TAG_RENDERING) {
+			CHECK(sites[i].samples == 4);
+			found = true;
+		}
+	}
+	CHECK(found);
+
+	Memory::reset_allocation_tracking();
+}
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
@@ -0,0 +1,176 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestStringName {
+
+struct InternData {
+	const Vector<String> *names = nullptr;
+	Vector<const void *> pointers;
+	int offset = 0;
+	int iterations = 0;
+	bool unique = false;
+};
+
+static void intern_names(void *p_userdata) {
+	InternData *data = (InternData *)p_userdata;
+	const int count = data->names->size();
+	for (int i = 0; i < data->iterations; i++) {
+		if (data->unique) {
+			// New names each time, so the table keeps inserting and erasing.
+			StringName name(itos(data->offset) + "_" + itos(i));
+		} else {
+			const int index = (i + data->offset) % count;
+			StringName name((*data->names)[index]);
+			if (i < count) {
+				data->pointers.write[index] = name.data_unique_pointer();
+			}
+		}
+	}
+}
+
+TEST_CASE("[StringName] Interning the same names from several threads") {
+	const int name_count = 2000;
+	const int thread_count = 8;
+
+	Vector<String> names;
+	for (int i = 0; i < name_count; i++) {
+		names.push_back(vformat("string_name_test_%d", i));
+	}
+
+	// Hold the first half of the names from the main thread, the rest is
+	// created and freed by the threads as they go.
+	Vector<StringName> held;
+	for (int i = 0; i < name_count / 2; i++) {
+		held.push_back(StringName(names[i]));
+	}
+
+	InternData data[thread_count];
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		data[i].names = &names;
+		data[i].pointers.resize(name_count);
+		data[i].offset = i * 37;
+		data[i].iterations = name_count * 4;
+		threads[i].start(intern_names, &data[i]);
+	}
+
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	for (int i = 0; i < held.size(); i++) {
+		CHECK(StringName::search(names[i]) == held[i]);
+	}
+	for (int i = held.size(); i < name_count; i++) {
+		CHECK(StringName::search(names[i]) == StringName());
+	}
+
+	// Every thread must have found the entry held by the main thread instead
+	// of inserting a duplicate.
+	for (int i = 0; i < thread_count; i++) {
+		for (int j = 0; j < held.size(); j++) {
+			CHECK(data[i].pointers[j] == held[j].data_unique_pointer());
+		}
+	}
+}
+
+TEST_CASE("[StringName] Creating and freeing names from several threads") {
+	const int thread_count = 8;
+	const Vector<String> names;
+
+	InternData data[thread_count];
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		data[i].names = &names;
+		data[i].offset = i;
+		data[i].iterations = 5000;
+		data[i].unique = true;
+		threads[i].start(intern_names, &data[i]);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	// Every name was released by its thread, so none of them should be left behind.
+	for (int i = 0; i < thread_count; i++) {
+		CHECK(StringName::search(itos(i) + "_0") == StringName());
+		CHECK(StringName::search(itos(i) + "_4999") == StringName());
+	}
+}
+
+TEST_CASE_BENCHMARK("[StringName][Benchmark] Interning from several threads") {
+	const int name_count = 4096;
+	const int iterations = 200000;
+
+	Vector<String> names;
+	Vector<StringName> held;
+	for (int i = 0; i < name_count; i++) {
+		names.push_back(vformat("string_name_benchmark_%d", i));
+		held.push_back(StringName(names[i]));
+	}
+
+	for (int thread_count = 1; thread_count <= 16; thread_count *= 2) {
+		uint64_t usec[2];
+		for (int unique = 0; unique < 2; unique++) {
+			Vector<InternData> data;
+			data.resize(thread_count);
+			for (int i = 0; i < thread_count; i++) {
+				InternData &d = data.write[i];
+				d.names = &names;
+				d.pointers.resize(name_count);
+				d.offset = i * 997;
+				d.iterations = iterations;
+				d.unique = unique == 1;
+			}
+			usec[unique] = TestUtils::time_threads(thread_count, [](void *p_data, int p_index) { intern_names(&((InternData *)p_data)[p_index]); }, data.ptrw());
+		}
+
+		BENCHMARK_MESSAGE("%d threads: %d lookups/s (existing names), %d inserts/s (new names).",
+				thread_count,
+				int64_t(thread_count * iterations * 1000000.0 / usec[0]),
+				int64_t(thread_count * iterations * 1000000.0 / usec[1]));
+	}
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
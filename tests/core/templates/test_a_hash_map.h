@@ -33,6 +33,7 @@
 #ifndef TEST_A_HASH_MAP_H
 #define TEST_A_HASH_MAP_H
 
+#include "core/os/os.h"
 #include "core/templates/a_hash_map.h"
 
 #include "tests/test_macros.h"
@@ -314,6 +315,60 @@ TEST_CASE("[AHashMap] Array methods") {
 	CHECK(map.get_index(1) == -1);
 }
 
+// Sends keys to a handful of home slots, so probe sequences get long and cross group boundaries.
+struct CollidingHasher {
+	static _FORCE_INLINE_ uint32_t hash(const int p_key) { return uint32_t(p_key % 13) * 7; }
+};
+
+TEST_CASE("[AHashMap] Insert, find and erase with many collisions") {
+	AHashMap<int, int, CollidingHasher> map;
+	for (int i = 0; i < 500; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 0; i < 1000; i++) {
+		CHECK(map.has(i) == (i < 500));
+	}
+	for (int i = 0; i < 500; i += 2) {
+		CHECK(map.erase(i));
+	}
+	for (int i = 0; i < 500; i++) {
+		CHECK(map.has(i) == (i % 2 == 1));
+	}
+	CHECK(map.size() == 250);
+}
+
+TEST_CASE_BENCHMARK("[AHashMap][Benchmark] Insert, lookup and erase") {
+	for (int count = 1000; count <= 10000000; count *= 10) {
+		AHashMap<int, int> map;
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.insert(i, i);
+		}
+		const uint64_t insert_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		// Half of the lookups miss.
+		int found = 0;
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = count / 2; i < count + count / 2; i++) {
+			found += map.has(i) ? 1 : 0;
+		}
+		const uint64_t lookup_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+		CHECK(found == count / 2);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			map.erase(i);
+		}
+		const uint64_t erase_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		BENCHMARK_MESSAGE("%d elements: %d inserts/ms, %d lookups/ms, %d erases/ms.",
+				count,
+				int64_t(count * 1000.0 / insert_usec),
+				int64_t(count * 1000.0 / lookup_usec),
+				int64_t(count * 1000.0 / erase_usec));
+	}
+}
+
 } // namespace TestAHashMap
 
 #endif // TEST_A_HASH_MAP_H
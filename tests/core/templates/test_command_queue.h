@@ -40,6 +40,7 @@
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestCommandQueue {
 
@@ -563,6 +564,256 @@ TEST_CASE("[CommandQueue] Test Parameter Passing Semantics") {
 
 	sts.destroy_threads();
 }
+
+class OrderingState {
+public:
+	static const int PRODUCER_COUNT = 4;
+	static const int COMMANDS_PER_PRODUCER = 5000;
+	static const int HANDOFFS = 2000;
+
+	CommandQueueMT command_queue;
+	SafeFlag exit;
+	SafeNumeric<int> turn;
+
+	// Only touched by the consumer.
+	int last_index[PRODUCER_COUNT] = { -1, -1, -1, -1 };
+	int last_handoff = -1;
+	int order_errors = 0;
+	int executed = 0;
+
+	struct ProducerData {
+		OrderingState *state = nullptr;
+		int index = 0;
+		int ret_errors = 0;
+	};
+	ProducerData producer_data[PRODUCER_COUNT];
+
+	void record(int p_producer, int p_index) {
+		if (last_index[p_producer] != p_index - 1) {
+			order_errors++;
+		}
+		last_index[p_producer] = p_index;
+		executed++;
+	}
+	void handoff(int p_index) {
+		if (last_handoff != p_index - 1) {
+			order_errors++;
+		}
+		last_handoff = p_index;
+	}
+	int doubled(int p_value) {
+		return p_value * 2;
+	}
+
+	static void consumer_loop(void *p_ud) {
+		OrderingState *state = static_cast<OrderingState *>(p_ud);
+		while (!state->exit.is_set()) {
+			state->command_queue.flush_if_pending();
+		}
+		state->command_queue.flush_all();
+	}
+
+	static void producer_loop(void *p_ud) {
+		ProducerData *data = static_cast<ProducerData *>(p_ud);
+		for (int i = 0; i < COMMANDS_PER_PRODUCER; i++) {
+			data->state->command_queue.push(data->state, &OrderingState::record, data->index, i);
+			if (i % 1000 == 0) {
+				int ret = 0;
+				data->state->command_queue.push_and_ret(data->state, &OrderingState::doubled, &ret, i);
+				if (ret != i * 2) {
+					data->ret_errors++;
+				}
+			}
+		}
+	}
+
+	// Two threads take turns, so each push happens after the previous one from the other thread.
+	static void handoff_loop(void *p_ud) {
+		ProducerData *data = static_cast<ProducerData *>(p_ud);
+		for (int i = data->index; i < HANDOFFS; i += 2) {
+			while (data->state->turn.get() != i) {
+			}
+			data->state->command_queue.push(data->state, &OrderingState::handoff, i);
+			data->state->turn.set(i + 1);
+		}
+	}
+};
+
+TEST_CASE("[CommandQueue] Commands from several producers run in push order") {
+	OrderingState state;
+	Thread consumer;
+	consumer.start(&OrderingState::consumer_loop, &state);
+
+	Thread producers[OrderingState::PRODUCER_COUNT];
+	for (int i = 0; i < OrderingState::PRODUCER_COUNT; i++) {
+		state.producer_data[i].state = &state;
+		state.producer_data[i].index = i;
+		producers[i].start(&OrderingState::producer_loop, &state.producer_data[i]);
+	}
+	for (int i = 0; i < OrderingState::PRODUCER_COUNT; i++) {
+		producers[i].wait_to_finish();
+		CHECK(state.producer_data[i].ret_errors == 0);
+	}
+
+	for (int i = 0; i < 2; i++) {
+		producers[i].start(&OrderingState::handoff_loop, &state.producer_data[i]);
+	}
+	for (int i = 0; i < 2; i++) {
+		producers[i].wait_to_finish();
+	}
+
+	state.command_queue.sync();
+	state.exit.set();
+	consumer.wait_to_finish();
+
+	CHECK_MESSAGE(state.order_errors == 0, "Commands should run in the order they were pushed.");
+	CHECK(state.executed == OrderingState::PRODUCER_COUNT * OrderingState::COMMANDS_PER_PRODUCER);
+	CHECK(state.last_handoff == OrderingState::HANDOFFS - 1);
+}
+
+class ProducerLifetimeState {
+public:
+	CommandQueueMT queues[2];
+	SafeNumeric<int> executed;
+
+	void count() {
+		executed.increment();
+	}
+
+	static void push_once(void *p_ud) {
+		ProducerLifetimeState *state = static_cast<ProducerLifetimeState *>(p_ud);
+		state->queues[0].push(state, &ProducerLifetimeState::count);
+	}
+};
+
+TEST_CASE("[CommandQueue] Producers of finished threads are freed") {
+	ProducerLifetimeState state;
+	for (int i = 0; i < 16; i++) {
+		Thread thread;
+		thread.start(&ProducerLifetimeState::push_once, &state);
+		thread.wait_to_finish();
+	}
+	state.queues[0].flush_all();
+	CHECK(state.executed.get() == 16);
+	CHECK_MESSAGE(state.queues[0].get_producer_count() == 0, "Producers should be freed once their thread exits and their commands ran.");
+
+	// Alternating between queues reuses the thread's producers rather than registering new ones.
+	for (int i = 0; i < 100; i++) {
+		state.queues[0].push(&state, &ProducerLifetimeState::count);
+		state.queues[1].push(&state, &ProducerLifetimeState::count);
+	}
+	state.queues[0].flush_all();
+	state.queues[1].flush_all();
+	CHECK(state.executed.get() == 216);
+	CHECK(state.queues[0].get_producer_count() == 1);
+	CHECK(state.queues[1].get_producer_count() == 1);
+}
+
+// The queue as it was before producers became lock-free, to compare against.
+class MutexCommandQueue {
+	struct CommandBase {
+		virtual void call() = 0;
+		virtual ~CommandBase() = default;
+	};
+
+	template <typename T, typename M, typename A>
+	struct Command : public CommandBase {
+		T *instance;
+		M method;
+		A arg;
+		Command(T *p_instance, M p_method, const A &p_arg) :
+				instance(p_instance), method(p_method), arg(p_arg) {}
+		void call() override { (instance->*method)(arg); }
+	};
+
+	BinaryMutex mutex;
+	LocalVector<uint8_t> command_mem;
+
+public:
+	template <typename T, typename M, typename A>
+	void push(T *p_instance, M p_method, const A &p_arg) {
+		using CommandType = Command<T, M, A>;
+		constexpr uint64_t alloc_size = ((sizeof(CommandType) + 8U - 1U) & ~(8U - 1U));
+		MutexLock lock(mutex);
+		uint64_t size = command_mem.size();
+		command_mem.resize(size + alloc_size + sizeof(uint64_t));
+		*(uint64_t *)&command_mem[size] = alloc_size;
+		new (&command_mem[size + sizeof(uint64_t)]) CommandType(p_instance, p_method, p_arg);
+	}
+
+	void flush_all() {
+		MutexLock lock(mutex);
+		uint64_t read_ptr = 0;
+		while (read_ptr < command_mem.size()) {
+			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
+			read_ptr += 8;
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+			cmd->call();
+			cmd->~CommandBase();
+			read_ptr += size;
+		}
+		command_mem.clear();
+	}
+
+	MutexCommandQueue() {
+		command_mem.reserve(64 * 1024);
+	}
+};
+
+template <typename Q>
+struct CommandQueueBenchmark {
+	Q queue;
+	SafeFlag exit;
+	SafeNumeric<uint64_t> executed;
+	int commands_per_producer = 0;
+
+	void set_transform(const Transform3D &p_transform) {
+		executed.increment();
+	}
+
+	static void consumer_loop(void *p_ud) {
+		CommandQueueBenchmark *b = static_cast<CommandQueueBenchmark *>(p_ud);
+		while (!b->exit.is_set()) {
+			b->queue.flush_all();
+		}
+		b->queue.flush_all();
+	}
+
+	static void producer_loop(void *p_ud) {
+		CommandQueueBenchmark *b = static_cast<CommandQueueBenchmark *>(p_ud);
+		Transform3D transform;
+		for (int i = 0; i < b->commands_per_producer; i++) {
+			b->queue.push(b, &CommandQueueBenchmark::set_transform, transform);
+		}
+	}
+
+	// Returns commands per second.
+	double run(int p_producers, int p_commands_per_producer) {
+		commands_per_producer = p_commands_per_producer;
+		Thread consumer;
+		consumer.start(&consumer_loop, this);
+
+		const uint64_t push_usec = TestUtils::time_threads(p_producers, [](void *p_ud, int p_index) { producer_loop(p_ud); }, this);
+
+		exit.set();
+		consumer.wait_to_finish();
+		CHECK(executed.get() == uint64_t(p_producers) * p_commands_per_producer);
+		return double(p_producers) * p_commands_per_producer * 1000000.0 / push_usec;
+	}
+};
+
+TEST_CASE_BENCHMARK("[CommandQueue][Benchmark] Commands per second") {
+	const int commands = 1000000;
+	for (int producers = 1; producers <= 4; producers++) {
+		CommandQueueBenchmark<MutexCommandQueue> mutex_benchmark;
+		const double mutex_rate = mutex_benchmark.run(producers, commands / producers);
+		CommandQueueBenchmark<CommandQueueMT> lock_free_benchmark;
+		const double lock_free_rate = lock_free_benchmark.run(producers, commands / producers);
+		BENCHMARK_MESSAGE("%d producer(s): mutex queue %d commands/s, CommandQueueMT %d commands/s (%.2fx).",
+				producers, int64_t(mutex_rate), int64_t(lock_free_rate), lock_free_rate / mutex_rate);
+	}
+}
+
 } // namespace TestCommandQueue
 
 #endif // TEST_COMMAND_QUEUE_H
@@ -33,6 +33,7 @@
 #ifndef TEST_HASH_SET_H
 #define TEST_HASH_SET_H
 
+#include "core/os/os.h"
 #include "core/templates/hash_set.h"
 
 #include "tests/test_macros.h"
@@ -241,6 +242,60 @@ TEST_CASE("[HashSet] Copy") {
 	}
 }
 
+// Sends keys to a handful of home slots, so probe sequences get long and cross group boundaries.
+struct CollidingHasher {
+	static _FORCE_INLINE_ uint32_t hash(const int p_key) { return uint32_t(p_key % 13) * 7; }
+};
+
+TEST_CASE("[HashSet] Insert, find and erase with many collisions") {
+	HashSet<int, CollidingHasher> set;
+	for (int i = 0; i < 500; i++) {
+		set.insert(i);
+	}
+	for (int i = 0; i < 1000; i++) {
+		CHECK(set.has(i) == (i < 500));
+	}
+	for (int i = 0; i < 500; i += 2) {
+		CHECK(set.erase(i));
+	}
+	for (int i = 0; i < 500; i++) {
+		CHECK(set.has(i) == (i % 2 == 1));
+	}
+	CHECK(set.size() == 250);
+}
+
+TEST_CASE_BENCHMARK("[HashSet][Benchmark] Insert, lookup and erase") {
+	for (int count = 1000; count <= 10000000; count *= 10) {
+		HashSet<int> set;
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			set.insert(i);
+		}
+		const uint64_t insert_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		// Half of the lookups miss.
+		int found = 0;
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = count / 2; i < count + count / 2; i++) {
+			found += set.has(i) ? 1 : 0;
+		}
+		const uint64_t lookup_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+		CHECK(found == count / 2);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i++) {
+			set.erase(i);
+		}
+		const uint64_t erase_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		BENCHMARK_MESSAGE("%d elements: %d inserts/ms, %d lookups/ms, %d erases/ms.",
+				count,
+				int64_t(count * 1000.0 / insert_usec),
+				int64_t(count * 1000.0 / lookup_usec),
+				int64_t(count * 1000.0 / erase_usec));
+	}
+}
+
 } // namespace TestHashSet
 
 #endif // TEST_HASH_SET_H
@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*  test_ordered_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ORDERED_HASH_MAP_H
+#define TEST_ORDERED_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/templates/ordered_hash_map.h"
+#include "core/variant/variant.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOrderedHashMap {
+
+TEST_CASE("[OrderedHashMap] List initialization") {
+	OrderedHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[OrderedHashMap] Insert and overwrite element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+	CHECK(!map.find(43));
+
+	map.insert(42, 1234);
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[OrderedHashMap] Erase keeps insertion order") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i * 7, i);
+	}
+	CHECK(map.erase(21));
+	CHECK(map.erase(0));
+	CHECK(!map.erase(0));
+	map.insert(100, 100);
+
+	const int expected[] = { 7, 14, 28, 35, 42, 49, 56, 63, 100 };
+	int i = 0;
+	for (const KeyValue<int, int> &E : map) {
+		REQUIRE(i < 9);
+		CHECK(E.key == expected[i]);
+		CHECK(map.get_by_index(i).key == expected[i]);
+		i++;
+	}
+	CHECK(i == 9);
+	CHECK(map.size() == 9);
+}
+
+TEST_CASE("[OrderedHashMap] Erase and insert many elements") {
+	// Goes through both reusing freed slots and growing.
+	OrderedHashMap<int, int> map;
+	for (int round = 0; round < 20; round++) {
+		for (int i = 0; i < 100; i++) {
+			map.insert(round * 100 + i, i);
+		}
+		for (int i = 0; i < 100; i += 3) {
+			CHECK(map.erase(round * 100 + i));
+		}
+	}
+
+	int previous = -1;
+	uint32_t count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key > previous);
+		CHECK(E.key % 100 % 3 != 0);
+		CHECK(map[E.key] == E.key % 100);
+		previous = E.key;
+		count++;
+	}
+	CHECK(count == map.size());
+	CHECK(map.size() == 20 * 66);
+}
+
+TEST_CASE("[OrderedHashMap] Elements don't move when inserting") {
+	OrderedHashMap<int, String> map;
+	map.insert(0, "A");
+	const String *first = map.getptr(0);
+	for (int i = 1; i < 1000; i++) {
+		// Reads the previous value while inserting, so it must stay in place.
+		map[i] = map[i - 1];
+		if (i % 3 == 0) {
+			map.erase(i - 2);
+		}
+	}
+	CHECK(map.getptr(0) == first);
+	CHECK(*first == "A");
+	CHECK(map[999] == "A");
+}
+
+TEST_CASE("[OrderedHashMap] Copy") {
+	OrderedHashMap<int, String> map0{ { 3, "A" }, { 1, "B" }, { 2, "C" } };
+	map0.erase(1);
+	OrderedHashMap<int, String> map1;
+	map1.insert(1234, "D");
+	map1 = map0;
+
+	CHECK(map1.size() == 2);
+	CHECK(map1.get_by_index(0).key == 3);
+	CHECK(map1.get_by_index(1).key == 2);
+	CHECK(!map1.has(1234));
+}
+
+TEST_CASE("[OrderedHashMap] Sort") {
+	OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> map;
+	map.insert(5, "five");
+	map.insert(1, "one");
+	map.insert(4, "four");
+	map.insert(2, "two");
+	map.erase(4);
+	map.sort();
+
+	CHECK(map.get_by_index(0).key == Variant(1));
+	CHECK(map.get_by_index(1).key == Variant(2));
+	CHECK(map.get_by_index(2).key == Variant(5));
+	CHECK(map[5] == Variant("five"));
+}
+
+template <typename TMap>
+static void benchmark_map(const char *p_name, const Vector<Variant> &p_keys) {
+	const int count = p_keys.size();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	TMap map;
+	for (int i = 0; i < count; i++) {
+		map[p_keys[i]] = i;
+	}
+	const uint64_t insert_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+	int64_t found = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		found += map.has(p_keys[i]) ? 1 : 0;
+	}
+	const uint64_t lookup_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+	int64_t sum = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int r = 0; r < 10; r++) {
+		for (const KeyValue<Variant, Variant> &E : map) {
+			sum += int64_t(E.value);
+		}
+	}
+	const uint64_t iterate_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+	CHECK(found == count);
+	CHECK(sum == int64_t(count) * (count - 1) * 5);
+
+	BENCHMARK_MESSAGE("%s, %d elements: insert %d us, lookup %d us, iterate %d us.", p_name, count, insert_usec, lookup_usec, iterate_usec / 10);
+}
+
+TEST_CASE_BENCHMARK("[OrderedHashMap][Benchmark] Against HashMap with Variant keys") {
+	for (int count = 1000; count <= 1000000; count *= 10) {
+		Vector<Variant> keys;
+		keys.resize(count);
+		for (int i = 0; i < count; i++) {
+			keys.write[i] = (i % 2) ? Variant(vformat("key_%d", i)) : Variant(i);
+		}
+		benchmark_map<HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>>("HashMap", keys);
+		benchmark_map<OrderedHashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>>("OrderedHashMap", keys);
+	}
+}
+
+} // namespace TestOrderedHashMap
+
+#endif // TEST_ORDERED_HASH_MAP_H
@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  test_work_stealing_deque.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_WORK_STEALING_DEQUE_H
+#define TEST_WORK_STEALING_DEQUE_H
+
+#include "core/os/thread.h"
+#include "core/templates/work_stealing_deque.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingDeque {
+
+TEST_CASE("[WorkStealingDeque] Owner pops LIFO, thieves steal FIFO") {
+	WorkStealingDeque<int, 8> deque;
+	int value = 0;
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+	CHECK_FALSE(deque.steal(value));
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK(deque.size_approx() == 4);
+
+	CHECK(deque.pop(value));
+	CHECK(value == 3);
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.steal(value));
+	CHECK(value == 1);
+	CHECK(deque.pop(value));
+	CHECK(value == 2);
+
+	CHECK(deque.is_empty());
+	CHECK_FALSE(deque.pop(value));
+}
+
+TEST_CASE("[WorkStealingDeque] Push fails when full") {
+	WorkStealingDeque<int, 4> deque;
+	int value = 0;
+
+	for (int i = 0; i < 4; i++) {
+		CHECK(deque.push(i));
+	}
+	CHECK_FALSE(deque.push(4));
+
+	// Stealing frees a slot, and wrapping around the ring buffer keeps the order.
+	CHECK(deque.steal(value));
+	CHECK(value == 0);
+	CHECK(deque.push(4));
+	for (int i = 1; i <= 4; i++) {
+		CHECK(deque.steal(value));
+		CHECK(value == i);
+	}
+	CHECK(deque.is_empty());
+}
+
+struct ThiefData {
+	WorkStealingDeque<uint32_t, 256> *deque = nullptr;
+	SafeFlag *done = nullptr;
+	uint64_t sum = 0;
+	uint32_t count = 0;
+};
+
+static void thief_function(void *p_userdata) {
+	ThiefData *data = (ThiefData *)p_userdata;
+	uint32_t value = 0;
+	while (!data->done->is_set() || !data->deque->is_empty()) {
+		if (data->deque->steal(value)) {
+			data->sum += value;
+			data->count++;
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingDeque] Every element is taken exactly once under contention") {
+	const uint32_t element_count = 100000;
+	const int thief_count = 3;
+
+	WorkStealingDeque<uint32_t, 256> deque;
+	SafeFlag done;
+	ThiefData thieves[thief_count];
+	Thread threads[thief_count];
+	for (int i = 0; i < thief_count; i++) {
+		thieves[i].deque = &deque;
+		thieves[i].done = &done;
+		threads[i].start(thief_function, &thieves[i]);
+	}
+
+	uint64_t sum = 0;
+	uint32_t count = 0;
+	uint32_t value = 0;
+	for (uint32_t i = 1; i <= element_count; i++) {
+		while (!deque.push(i)) {
+			if (deque.pop(value)) {
+				sum += value;
+				count++;
+			}
+		}
+		if (i % 3 == 0 && deque.pop(value)) {
+			sum += value;
+			count++;
+		}
+	}
+	while (deque.pop(value)) {
+		sum += value;
+		count++;
+	}
+
+	done.set();
+	for (int i = 0; i < thief_count; i++) {
+		threads[i].wait_to_finish();
+		sum += thieves[i].sum;
+		count += thieves[i].count;
+	}
+
+	CHECK(count == element_count);
+	CHECK(sum == uint64_t(element_count) * (element_count + 1) / 2);
+}
+
+} // namespace TestWorkStealingDeque
+
+#endif // TEST_WORK_STEALING_DEQUE_H
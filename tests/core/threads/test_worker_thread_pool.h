@@ -175,6 +175,254 @@ TEST_CASE("[WorkerThreadPool] Run a yielding daemon as the only hope for other t
 	CHECK_MESSAGE(all_needed_yield, "All legit tasks should have needed the daemon yielding to run.");
 }
 
+static const int NESTED_SUBTASK_COUNT = 64;
+
+static void static_nested_subtask(void *p_arg) {
+	counter[(uintptr_t)p_arg].increment();
+}
+
+static void static_nested_root_task(void *p_arg) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const uintptr_t base = (uintptr_t)p_arg * NESTED_SUBTASK_COUNT;
+
+	// Posted from a pool thread, so these go through the thread's local queue and can be stolen.
+	WorkerThreadPool::TaskID subtasks[NESTED_SUBTASK_COUNT];
+	for (int i = 0; i < NESTED_SUBTASK_COUNT; i++) {
+		subtasks[i] = pool->add_native_task(static_nested_subtask, (void *)(base + i), true);
+	}
+
+	for (int i = 0; i < NESTED_SUBTASK_COUNT; i++) {
+		pool->wait_for_task_completion(subtasks[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Process tasks posted from pool threads") {
+	for (int iterations = 0; iterations < 50; iterations++) {
+		const int root_count = Math::pow(2.0f, Math::random(0.0f, 4.0f));
+
+		counter.clear();
+		counter.resize(root_count * NESTED_SUBTASK_COUNT);
+
+		LocalVector<WorkerThreadPool::TaskID> roots;
+		for (int i = 0; i < root_count; i++) {
+			roots.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_root_task, (void *)(uintptr_t)i, true));
+		}
+		for (uint32_t i = 0; i < roots.size(); i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(roots[i]);
+		}
+
+		bool all_run_once = true;
+		for (int i = 0; i < root_count * NESTED_SUBTASK_COUNT; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+struct GraphTestData {
+	LocalVector<int> values;
+	SafeNumeric<int> sum;
+	SafeNumeric<int> step;
+	int order[4] = {};
+};
+
+static void graph_fill_group(void *p_arg, uint32_t p_index) {
+	GraphTestData *data = (GraphTestData *)p_arg;
+	data->values[p_index] = p_index + 1;
+}
+
+static void graph_sum_group(void *p_arg, uint32_t p_index) {
+	GraphTestData *data = (GraphTestData *)p_arg;
+	data->sum.add(data->values[p_index]);
+}
+
+static void graph_scale_group(void *p_arg, uint32_t p_index) {
+	GraphTestData *data = (GraphTestData *)p_arg;
+	data->values[p_index] *= data->sum.get();
+}
+
+static void graph_diamond_top(void *p_arg) {
+	((GraphTestData *)p_arg)->order[0] = ((GraphTestData *)p_arg)->step.increment();
+}
+static void graph_diamond_left(void *p_arg) {
+	((GraphTestData *)p_arg)->order[1] = ((GraphTestData *)p_arg)->step.increment();
+}
+static void graph_diamond_right(void *p_arg) {
+	((GraphTestData *)p_arg)->order[2] = ((GraphTestData *)p_arg)->step.increment();
+}
+static void graph_diamond_bottom(void *p_arg) {
+	((GraphTestData *)p_arg)->order[3] = ((GraphTestData *)p_arg)->step.increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Task graph runs stages in dependency order") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 8.0f));
+		const bool high_priority = Math::rand() % 2;
+
+		GraphTestData data;
+		data.values.resize(count);
+
+		WorkerThreadPool::TaskGraph graph;
+		WorkerThreadPool::TaskGraph::NodeID fill = graph.add_native_group_task(graph_fill_group, &data, count, -1, high_priority);
+		WorkerThreadPool::TaskGraph::NodeID sum = graph.add_native_group_task(graph_sum_group, &data, count, -1, high_priority);
+		WorkerThreadPool::TaskGraph::NodeID scale = graph.add_native_group_task(graph_scale_group, &data, count, -1, high_priority);
+		graph.add_dependency(sum, fill);
+		graph.add_dependency(scale, sum);
+		CHECK(graph.get_node_count() == 3);
+
+		WorkerThreadPool::TaskID task_id = pool->submit_task_graph(graph);
+		CHECK(task_id != WorkerThreadPool::INVALID_TASK_ID);
+		CHECK(graph.is_empty());
+		CHECK(pool->wait_for_task_completion(task_id) == OK);
+
+		const int expected_sum = count * (count + 1) / 2;
+		CHECK(data.sum.get() == expected_sum);
+		bool all_scaled = true;
+		for (int i = 0; i < count; i++) {
+			all_scaled &= data.values[i] == (i + 1) * expected_sum;
+		}
+		CHECK(all_scaled);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Task graph with diamond and external dependencies") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	for (int iterations = 0; iterations < 100; iterations++) {
+		GraphTestData data;
+
+		// Already submitted work, which the graph has to wait for.
+		WorkerThreadPool::TaskID external_task = pool->add_native_task(graph_diamond_top, &data, true);
+
+		WorkerThreadPool::TaskGraph graph;
+		WorkerThreadPool::TaskGraph::NodeID left = graph.add_native_task(graph_diamond_left, &data);
+		WorkerThreadPool::TaskGraph::NodeID right = graph.add_native_task(graph_diamond_right, &data, true);
+		WorkerThreadPool::TaskGraph::NodeID bottom = graph.add_native_task(graph_diamond_bottom, &data);
+		graph.add_task_dependency(left, external_task);
+		graph.add_task_dependency(right, external_task);
+		graph.add_dependency(bottom, left);
+		graph.add_dependency(bottom, right);
+
+		WorkerThreadPool::TaskID task_id = pool->submit_task_graph(graph);
+		pool->wait_for_task_completion(task_id);
+		pool->wait_for_task_completion(external_task);
+
+		CHECK(data.step.get() == 4);
+		CHECK(data.order[0] < data.order[1]);
+		CHECK(data.order[0] < data.order[2]);
+		CHECK(data.order[1] < data.order[3]);
+		CHECK(data.order[2] < data.order[3]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Task graph edge cases") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	// An empty graph completes right away.
+	WorkerThreadPool::TaskGraph graph;
+	WorkerThreadPool::TaskID task_id = pool->submit_task_graph(graph);
+	CHECK(pool->wait_for_task_completion(task_id) == OK);
+
+	// Empty groups don't hold their successors back.
+	GraphTestData data;
+	WorkerThreadPool::TaskGraph::NodeID empty = graph.add_native_group_task(graph_sum_group, &data, 0);
+	WorkerThreadPool::TaskGraph::NodeID after = graph.add_native_task(graph_diamond_top, &data);
+	graph.add_dependency(after, empty);
+
+	ERR_PRINT_OFF;
+	// Only backward edges are allowed.
+	graph.add_dependency(empty, after);
+	ERR_PRINT_ON;
+
+	task_id = pool->submit_task_graph(graph);
+	CHECK(pool->wait_for_task_completion(task_id) == OK);
+	CHECK(data.step.get() == 1);
+}
+
+static void static_benchmark_task(void *p_arg) {
+	counter[0].increment();
+}
+
+static void static_benchmark_group_task(void *p_arg, uint32_t p_index) {
+	counter[0].increment();
+}
+
+struct BenchmarkNestedData {
+	WorkerThreadPool *pool = nullptr;
+	int subtasks = 0;
+};
+
+static void static_benchmark_nested_root_task(void *p_arg) {
+	BenchmarkNestedData *data = (BenchmarkNestedData *)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> ids;
+	ids.resize(data->subtasks);
+	for (int i = 0; i < data->subtasks; i++) {
+		ids[i] = data->pool->add_native_task(static_benchmark_task, nullptr, true);
+	}
+	for (int i = 0; i < data->subtasks; i++) {
+		data->pool->wait_for_task_completion(ids[i]);
+	}
+}
+
+TEST_CASE_BENCHMARK("[WorkerThreadPool][Benchmark] Tasks per second") {
+	const int task_count = 100000;
+
+	for (int thread_count = 1; thread_count <= 64; thread_count *= 2) {
+		WorkerThreadPool *pool = memnew(WorkerThreadPool(false));
+		pool->init(thread_count);
+
+		counter.clear();
+		counter.resize(1);
+
+		// Individual tasks posted from the main thread (shared queue).
+		LocalVector<WorkerThreadPool::TaskID> ids;
+		ids.resize(task_count);
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < task_count; i++) {
+			ids[i] = pool->add_native_task(static_benchmark_task, nullptr, true);
+		}
+		for (int i = 0; i < task_count; i++) {
+			pool->wait_for_task_completion(ids[i]);
+		}
+		const uint64_t single_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		// Many small group tasks, one task per thread each.
+		const int group_count = task_count / 100;
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < group_count; i++) {
+			WorkerThreadPool::GroupID group = pool->add_native_group_task(static_benchmark_group_task, nullptr, 100, thread_count, true);
+			pool->wait_for_group_task_completion(group);
+		}
+		const uint64_t group_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		// Tasks posted from pool threads (local queues and stealing).
+		BenchmarkNestedData nested_data;
+		nested_data.pool = pool;
+		nested_data.subtasks = task_count / thread_count;
+		ids.resize(thread_count);
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < thread_count; i++) {
+			ids[i] = pool->add_native_task(static_benchmark_nested_root_task, &nested_data, true);
+		}
+		for (int i = 0; i < thread_count; i++) {
+			pool->wait_for_task_completion(ids[i]);
+		}
+		const uint64_t nested_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		CHECK(counter[0].get() == task_count + group_count * 100 + nested_data.subtasks * thread_count);
+
+		BENCHMARK_MESSAGE("%d threads: %d tasks/s (main thread), %d elements/s (small groups), %d tasks/s (pool threads).",
+				thread_count,
+				int64_t(task_count * 1000000.0 / single_usec),
+				int64_t(group_count * 100 * 1000000.0 / group_usec),
+				int64_t(nested_data.subtasks * thread_count * 1000000.0 / nested_usec));
+
+		memdelete(pool);
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  test_array_view.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ARRAY_VIEW_H
+#define TEST_ARRAY_VIEW_H
+
+#include "core/variant/array_view.h"
+
+#include "tests/test_macros.h"
+
+namespace TestArrayView {
+
+static Array build_array(std::initializer_list<Variant> p_values) {
+	Array array;
+	for (const Variant &value : p_values) {
+		array.push_back(value);
+	}
+	return array;
+}
+
+TEST_CASE("[ArrayView] Viewing a packed array") {
+	PackedInt32Array array = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	Ref<ArrayView> view = ArrayView::create(array, 2, -2);
+
+	CHECK(view->size() == 4);
+	CHECK(view->get_at(0) == Variant(2));
+	CHECK(view->get_at(3) == Variant(5));
+
+	bool valid = false;
+	CHECK(view->getvar(-1, &valid) == Variant(5));
+	CHECK(valid);
+	view->getvar(4, &valid);
+	CHECK_FALSE(valid);
+
+	Ref<ArrayView> sub = view->slice(1, 3);
+	CHECK(sub->size() == 2);
+	CHECK(sub->get_at(0) == Variant(3));
+	CHECK(sub->to_array() == Variant(PackedInt32Array({ 3, 4 })));
+
+	// Clamped to the array.
+	CHECK(ArrayView::create(array, 6, 100)->size() == 2);
+	CHECK(ArrayView::create(array, 5, 2)->is_empty());
+
+	// The source is copied on write, so the view keeps the data it was created from.
+	array.set(2, 20);
+	CHECK(view->get_at(0) == Variant(2));
+	CHECK(ArrayView::create(array, 2, -2)->get_at(0) == Variant(20));
+}
+
+TEST_CASE("[ArrayView] Iterating") {
+	Array array = build_array({ "a", "b", "c", "d" });
+	Ref<ArrayView> view = ArrayView::create(array, 1);
+
+	Array iter;
+	iter.push_back(Variant());
+	String joined;
+	for (bool more = view->_iter_init(iter); more; more = view->_iter_next(iter)) {
+		joined += String(view->_iter_get(iter[0]));
+	}
+	CHECK(joined == "bcd");
+}
+
+TEST_CASE("[ArrayView] Writing copies the viewed range") {
+	Array array = build_array({ 0, 1, 2, 3 });
+	Ref<ArrayView> view = ArrayView::create(array, 1, 3);
+
+	// Sees changes to the source until written to.
+	array[1] = 10;
+	CHECK(view->get_at(0) == Variant(10));
+
+	view->set_at(1, 20);
+	CHECK(view->get_at(1) == Variant(20));
+	CHECK(array == build_array({ 0, 10, 2, 3 }));
+
+	array[1] = 30;
+	CHECK(view->get_at(0) == Variant(10));
+	CHECK(view->to_array() == Variant(build_array({ 10, 20 })));
+}
+
+} // namespace TestArrayView
+
+#endif // TEST_ARRAY_VIEW_H
@@ -596,6 +596,24 @@ TEST_CASE("[Dictionary] Typed copying") {
 	d6.clear();
 }
 
+TEST_CASE("[Dictionary] Copying a value to a new key while the dictionary grows") {
+	Dictionary d;
+	d["key_0"] = String("value");
+	// Each assignment binds the existing value, then inserts a new key, enough times to grow several times.
+	for (int i = 1; i < 200; i++) {
+		d[vformat("key_%d", i)] = d[vformat("key_%d", i - 1)];
+	}
+	CHECK(d.size() == 200);
+	CHECK(String(d["key_199"]) == "value");
+
+	const Variant *first = d.getptr("key_0");
+	for (int i = 200; i < 1000; i++) {
+		d[i] = i;
+	}
+	CHECK_MESSAGE(d.getptr("key_0") == first, "Values should not move when other keys are inserted.");
+	CHECK(String(*first) == "value");
+}
+
 } // namespace TestDictionary
 
 #endif // TEST_DICTIONARY_H
@@ -311,6 +311,87 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sampling with a key cursor matches sampling without one") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	for (int i = 0; i < 16; i++) {
+		animation->position_track_insert_key(track_index, i * 0.125, Vector3(i, i * i, -i));
+	}
+
+	Animation::KeyCursor cursor;
+	Vector3 with_cursor;
+	Vector3 without_cursor;
+
+	// Play forward past the loop point, then backward, then seek around.
+	for (int i = 0; i < 100; i++) {
+		const double time = Math::fmod(i * 0.03, 2.0);
+		CHECK(animation->try_position_track_interpolate(track_index, time, &with_cursor, false, &cursor) == OK);
+		CHECK(animation->try_position_track_interpolate(track_index, time, &without_cursor) == OK);
+		CHECK(with_cursor == without_cursor);
+	}
+	for (int i = 100; i >= 0; i--) {
+		const double time = Math::fmod(i * 0.03, 2.0);
+		CHECK(animation->try_position_track_interpolate(track_index, time, &with_cursor, true, &cursor) == OK);
+		CHECK(animation->try_position_track_interpolate(track_index, time, &without_cursor, true) == OK);
+		CHECK(with_cursor == without_cursor);
+	}
+	const double seeks[] = { 1.5, 0.0, 0.125, 1.875, -0.1, 0.3, 0.3, 1.99 };
+	for (double time : seeks) {
+		CHECK(animation->try_position_track_interpolate(track_index, time, &with_cursor, false, &cursor) == OK);
+		CHECK(animation->try_position_track_interpolate(track_index, time, &without_cursor) == OK);
+		CHECK(with_cursor == without_cursor);
+	}
+
+	// A cursor left over from a longer track only costs a regular search.
+	animation->track_remove_key(track_index, 15);
+	animation->track_remove_key(track_index, 14);
+	cursor.key = 14;
+	CHECK(animation->try_position_track_interpolate(track_index, 1.9, &with_cursor, false, &cursor) == OK);
+	CHECK(animation->try_position_track_interpolate(track_index, 1.9, &without_cursor) == OK);
+	CHECK(with_cursor == without_cursor);
+}
+
+TEST_CASE("[Animation] Sampling compressed tracks through the decoded page cache") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(4.0);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Enemy:position"));
+	for (int i = 0; i <= 120; i++) {
+		animation->position_track_insert_key(track_index, i / 30.0, Vector3(i * 0.1, Math::sin(i * 0.2), 2.0 - i * 0.05));
+	}
+
+	Ref<Animation> compressed = animation->duplicate();
+	compressed->compress(256); // Small pages, so sampling crosses several of them.
+	CHECK(compressed->track_is_compressed(track_index));
+
+	// The second pass samples pages that are already decoded.
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = -5; i <= 250; i++) {
+			const double time = i / 60.0;
+			Vector3 expected;
+			Vector3 sampled;
+			CHECK(animation->try_position_track_interpolate(track_index, time, &expected) == OK);
+			CHECK(compressed->try_position_track_interpolate(track_index, time, &sampled) == OK);
+			CHECK(sampled.distance_to(expected) < 0.01);
+		}
+	}
+
+	// Compressing other data must not reuse what was decoded for the old pages.
+	Ref<Animation> other = memnew(Animation);
+	other->set_length(4.0);
+	other->add_track(Animation::TYPE_POSITION_3D);
+	other->track_set_path(0, NodePath("Enemy:position"));
+	other->position_track_insert_key(0, 0.0, Vector3(-1, -1, -1));
+	other->position_track_insert_key(0, 4.0, Vector3(1, 1, 1));
+	other->compress(256);
+	Vector3 sampled;
+	CHECK(other->try_position_track_interpolate(0, 2.0, &sampled) == OK);
+	CHECK(sampled.distance_to(Vector3()) < 0.01);
+}
+
 } // namespace TestAnimation
 
 #endif // TEST_ANIMATION_H
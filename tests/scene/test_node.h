@@ -906,6 +906,70 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Groups with many nodes") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	Vector<Node *> children;
+	for (int i = 0; i < 100; i++) {
+		Node *child = memnew(Node);
+		parent->add_child(child);
+		child->add_to_group("many");
+		children.push_back(child);
+	}
+
+	SUBCASE("Removing nodes should keep the others in tree order") {
+		for (int i = 0; i < 100; i += 3) {
+			children[i]->remove_from_group("many");
+		}
+		// Adding a node back puts it at its tree position, not at the end.
+		children[0]->add_to_group("many");
+
+		List<Node *> nodes;
+		SceneTree::get_singleton()->get_nodes_in_group("many", &nodes);
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("many"), 67);
+		CHECK_EQ(nodes.size(), 67);
+		CHECK_EQ(nodes.front()->get(), children[0]);
+		CHECK_EQ(nodes.back()->get(), children[98]);
+
+		int previous = -1;
+		bool ordered = true;
+		for (Node *node : nodes) {
+			int index = node->get_index();
+			ordered = ordered && index > previous;
+			previous = index;
+		}
+		CHECK(ordered);
+
+		for (Node *child : children) {
+			child->remove_from_group("many");
+		}
+		CHECK_FALSE(SceneTree::get_singleton()->has_group("many"));
+	}
+
+	SUBCASE("Parallel group calls should reach every node once") {
+		// Split the children across sub-thread process groups, leaving some on the main thread.
+		for (int i = 0; i < 100; i++) {
+			if (i % 4 != 0) {
+				children[i]->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+			}
+		}
+
+		SceneTree::get_singleton()->call_group_parallel("many", "set_meta", StringName("called"), 1);
+		SceneTree::get_singleton()->call_group_parallel("many", "set_meta", StringName("called"), 2);
+
+		int called = 0;
+		for (Node *child : children) {
+			if (child->get_meta("called", 0) == Variant(2)) {
+				called++;
+			}
+		}
+		CHECK_EQ(called, 100);
+	}
+
+	memdelete(parent);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
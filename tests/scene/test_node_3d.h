@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformCounter : public Node3D {
+	GDCLASS(TransformCounter, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changes++;
+		}
+	}
+
+public:
+	int transform_changes = 0;
+
+	TransformCounter() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Transform changes reach every descendant") {
+	Node3D *root = memnew(Node3D);
+	Node3D *middle = memnew(Node3D);
+	TransformCounter *leaf = memnew(TransformCounter);
+	middle->set_position(Vector3(0, 1, 0));
+	leaf->set_position(Vector3(0, 0, 1));
+	root->add_child(middle);
+	middle->add_child(leaf);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	leaf->transform_changes = 0;
+
+	SUBCASE("Moving a node several times before the flush notifies once with the last transform") {
+		root->set_position(Vector3(1, 0, 0));
+		root->set_position(Vector3(2, 0, 0));
+		root->rotate_y(Math_PI);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(2, 1, -1)));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changes, 1);
+	}
+
+	SUBCASE("Reading back a global transform between moves does not hide later ones") {
+		root->set_position(Vector3(1, 0, 0));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(1, 1, 0)));
+		root->set_position(Vector3(2, 0, 0));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(2, 1, 0)));
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 1, 1)));
+		root->set_position(Vector3(4, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(4, 1, 1)));
+	}
+
+	SUBCASE("Moves after a flush are notified again") {
+		root->set_position(Vector3(1, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		root->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changes, 2);
+	}
+
+	SUBCASE("Nodes entering or enabling notifications under a moved node are still reached") {
+		root->set_position(Vector3(1, 0, 0));
+		TransformCounter *late = memnew(TransformCounter);
+		middle->add_child(late);
+		Node3D *quiet = memnew(Node3D);
+		middle->add_child(quiet);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		late->transform_changes = 0;
+
+		root->set_position(Vector3(2, 0, 0));
+		quiet->set_notify_transform(true);
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(late->get_global_position().is_equal_approx(Vector3(3, 1, 0)));
+		CHECK(quiet->get_global_position().is_equal_approx(Vector3(3, 1, 0)));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(late->transform_changes, 1);
+		CHECK_EQ(leaf->transform_changes, 2);
+	}
+
+	SUBCASE("Moves after forcing a node's update in the same frame are notified again") {
+		root->set_position(Vector3(1, 0, 0));
+		leaf->force_update_transform();
+		CHECK_EQ(leaf->transform_changes, 1);
+
+		root->set_position(Vector3(2, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_EQ(leaf->transform_changes, 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(2, 1, 1)));
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -47,6 +47,13 @@
 // The test is skipped with this, run pending tests with `--test --no-skip`.
 #define TEST_CASE_PENDING(name) TEST_CASE(name *doctest::skip())
 
+// Benchmarks are skipped by default, as they are slow and only report timings.
+// Run them with `--test --no-skip --test-case="*[Benchmark]*"`.
+#define TEST_CASE_BENCHMARK(name) TEST_CASE(name *doctest::skip())
+
+// Reports a benchmark result, with the arguments formatted as in vformat().
+#define BENCHMARK_MESSAGE(...) MESSAGE(vformat(__VA_ARGS__).utf8().get_data())
+
 // The test case is marked as failed, but does not fail the entire test run.
 #define TEST_CASE_MAY_FAIL(name) TEST_CASE(name *doctest::may_fail())
 
@@ -34,6 +34,8 @@
 
 #include "core/io/dir_access.h"
 #include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 
 String TestUtils::get_data_path(const String &p_file) {
 	String data_path = "../tests/data";
@@ -49,3 +51,31 @@ String TestUtils::get_temp_path(const String &p_suffix) {
 	DirAccess::make_dir_absolute(temp_base); // Ensure the directory exists.
 	return temp_base.path_join(p_suffix);
 }
+
+uint64_t TestUtils::time_threads(int p_thread_count, void (*p_function)(void *p_userdata, int p_thread_index), void *p_userdata) {
+	struct TimedThread {
+		void (*function)(void *p_userdata, int p_thread_index) = nullptr;
+		void *userdata = nullptr;
+		int index = 0;
+		Thread thread;
+
+		static void run(void *p_timed_thread) {
+			TimedThread *timed_thread = (TimedThread *)p_timed_thread;
+			timed_thread->function(timed_thread->userdata, timed_thread->index);
+		}
+	};
+
+	LocalVector<TimedThread> threads;
+	threads.resize(p_thread_count);
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_thread_count; i++) {
+		threads[i].function = p_function;
+		threads[i].userdata = p_userdata;
+		threads[i].index = i;
+		threads[i].thread.start(&TimedThread::run, &threads[i]);
+	}
+	for (TimedThread &timed_thread : threads) {
+		timed_thread.thread.wait_to_finish();
+	}
+	return MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+}
@@ -33,6 +33,8 @@
 #ifndef TEST_UTILS_H
 #define TEST_UTILS_H
 
+#include <cstdint>
+
 class String;
 
 namespace TestUtils {
@@ -40,6 +42,10 @@ namespace TestUtils {
 String get_data_path(const String &p_file);
 String get_executable_dir();
 String get_temp_path(const String &p_suffix);
+
+// Runs `p_function` on `p_thread_count` threads started together, passing each its index,
+// and returns how long they took to finish in microseconds (at least 1, so rates can be computed).
+uint64_t time_threads(int p_thread_count, void (*p_function)(void *p_userdata, int p_thread_index), void *p_userdata);
 } // namespace TestUtils
 
 #endif // TEST_UTILS_H